@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace dsa {
+    /**
+     * @brief A free-list object pool for fixed-size nodes.
+     *
+     * Node-based structures (heaps, chains, lists) normally pay one heap
+     * allocation per node. This pool carves nodes out of chunks of ChunkSize
+     * slots and recycles freed slots through an intrusive free list, so
+     * create() and destroy() are a couple of pointer moves.
+     *
+     * Two pools of the same type can be merged in O(1) with absorb(), which is
+     * what lets node-based containers splice each other's nodes (e.g. melding
+     * heaps) without copying.
+     *
+     * Note: The pool releases its memory on destruction but does not run the
+     * destructors of nodes that are still live; the owning container must
+     * destroy() its nodes first.
+     *
+     * @tparam T The node type.
+     * @tparam ChunkSize The number of slots allocated at a time.
+     */
+    template<typename T, size_t ChunkSize = 256>
+    class NodePool {
+        static_assert(ChunkSize > 0, "NodePool chunks must hold at least one node.");
+
+    private:
+        /**
+         * @brief A slot is either free (a free-list link) or holds a T.
+         */
+        union Slot {
+            Slot* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        /**
+         * @brief A block of slots; chunks form a singly linked list.
+         */
+        struct Chunk {
+            Chunk* next = nullptr;
+            Slot   slots[ChunkSize];
+        };
+
+        Chunk* chunks_    = nullptr;  // All chunks owned by this pool.
+        Chunk* lastChunk_ = nullptr;  // Tail of chunks_, for O(1) absorb().
+        Slot*  freeHead_  = nullptr;  // Free list of unused slots.
+        Slot*  freeTail_  = nullptr;  // Tail of the free list, for O(1) absorb().
+        size_t live_      = 0;        // Number of created, not yet destroyed, nodes.
+        size_t chunkCount_ = 0;       // Number of chunks in chunks_.
+
+        /// @brief Allocates a new chunk and threads its slots onto the free list.
+        void addChunk();
+
+    public:
+        NodePool() = default;
+        ~NodePool();
+
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+        /// @brief Move constructor. Takes ownership of another pool's chunks.
+        NodePool(NodePool&& other) noexcept;
+        /// @brief Move assignment. Releases this pool's chunks and takes the other's.
+        NodePool& operator=(NodePool&& other) noexcept;
+
+        /**
+         * @brief Constructs a node in a free slot. Amortized O(1).
+         * @return Pointer to the new node.
+         */
+        template<typename... Args>
+        T* create(Args&&... args);
+
+        /**
+         * @brief Destroys a node and returns its slot to the free list. O(1).
+         * @param node A node created by this pool (or one it absorbed). Null is ignored.
+         */
+        void destroy(T* node);
+
+        /**
+         * @brief Takes over all chunks and free slots of another pool. O(1).
+         * Nodes created by other stay valid and may now be destroyed through this pool.
+         * @param other The pool to absorb; left empty.
+         */
+        void absorb(NodePool& other);
+
+        /// @brief Returns the number of live nodes. O(1).
+        size_t liveCount() const;
+
+        /// @brief Returns the number of chunks the pool owns. O(1).
+        size_t chunkCount() const;
+    };
+
+} // namespace dsa
+
+#include "NodePool.tpp"
@@ -0,0 +1,126 @@
+namespace dsa {
+
+    template<typename T, size_t ChunkSize>
+    NodePool<T, ChunkSize>::~NodePool() {
+        while (chunks_) {
+            Chunk* next = chunks_->next;
+            delete chunks_;
+            chunks_ = next;
+        }
+    }
+
+    // Move constructor
+    template<typename T, size_t ChunkSize>
+    NodePool<T, ChunkSize>::NodePool(NodePool&& other) noexcept
+        : chunks_(other.chunks_), lastChunk_(other.lastChunk_),
+          freeHead_(other.freeHead_), freeTail_(other.freeTail_), live_(other.live_),
+          chunkCount_(other.chunkCount_) {
+        other.chunks_ = other.lastChunk_ = nullptr;
+        other.freeHead_ = other.freeTail_ = nullptr;
+        other.live_ = other.chunkCount_ = 0;
+    }
+
+    // Move assignment operator
+    template<typename T, size_t ChunkSize>
+    NodePool<T, ChunkSize>& NodePool<T, ChunkSize>::operator=(NodePool&& other) noexcept {
+        if (this == &other) return *this;
+
+        NodePool released(std::move(*this)); // frees our chunks on scope exit
+        chunks_ = other.chunks_;
+        lastChunk_ = other.lastChunk_;
+        freeHead_ = other.freeHead_;
+        freeTail_ = other.freeTail_;
+        live_ = other.live_;
+        chunkCount_ = other.chunkCount_;
+
+        other.chunks_ = other.lastChunk_ = nullptr;
+        other.freeHead_ = other.freeTail_ = nullptr;
+        other.live_ = other.chunkCount_ = 0;
+        return *this;
+    }
+
+    template<typename T, size_t ChunkSize>
+    void NodePool<T, ChunkSize>::addChunk() {
+        Chunk* chunk = new Chunk;
+        for (size_t i = 0; i + 1 < ChunkSize; ++i) {
+            chunk->slots[i].next = &chunk->slots[i + 1];
+        }
+        chunk->slots[ChunkSize - 1].next = nullptr;
+
+        // Only called when the free list is empty.
+        freeHead_ = &chunk->slots[0];
+        freeTail_ = &chunk->slots[ChunkSize - 1];
+
+        if (lastChunk_) lastChunk_->next = chunk;
+        else chunks_ = chunk;
+        lastChunk_ = chunk;
+        ++chunkCount_;
+    }
+
+    template<typename T, size_t ChunkSize>
+    template<typename... Args>
+    T* NodePool<T, ChunkSize>::create(Args&&... args) {
+        if (!freeHead_) addChunk();
+
+        Slot* slot = freeHead_;
+        freeHead_ = slot->next;
+        if (!freeHead_) freeTail_ = nullptr;
+
+        T* node;
+        try {
+            node = new (slot->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            // Put the slot back so a throwing constructor leaks nothing.
+            slot->next = freeHead_;
+            freeHead_ = slot;
+            if (!freeTail_) freeTail_ = slot;
+            throw;
+        }
+        ++live_;
+        return node;
+    }
+
+    template<typename T, size_t ChunkSize>
+    void NodePool<T, ChunkSize>::destroy(T* node) {
+        if (!node) return;
+        node->~T();
+
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = freeHead_;
+        freeHead_ = slot;
+        if (!freeTail_) freeTail_ = slot;
+        --live_;
+    }
+
+    template<typename T, size_t ChunkSize>
+    void NodePool<T, ChunkSize>::absorb(NodePool& other) {
+        if (this == &other || !other.chunks_) return;
+
+        if (lastChunk_) lastChunk_->next = other.chunks_;
+        else chunks_ = other.chunks_;
+        lastChunk_ = other.lastChunk_;
+
+        if (other.freeHead_) {
+            if (freeTail_) freeTail_->next = other.freeHead_;
+            else freeHead_ = other.freeHead_;
+            freeTail_ = other.freeTail_;
+        }
+        live_ += other.live_;
+        chunkCount_ += other.chunkCount_;
+
+        other.chunks_ = other.lastChunk_ = nullptr;
+        other.freeHead_ = other.freeTail_ = nullptr;
+        other.live_ = other.chunkCount_ = 0;
+    }
+
+    template<typename T, size_t ChunkSize>
+    size_t NodePool<T, ChunkSize>::liveCount() const {
+        return live_;
+    }
+
+    template<typename T, size_t ChunkSize>
+    size_t NodePool<T, ChunkSize>::chunkCount() const {
+        return chunkCount_;
+    }
+
+} // namespace dsa
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "NodePool.h"
+
+using namespace dsa;
+
+TEST(NodePoolTest, CreateAndDestroy) {
+    NodePool<std::string, 4> pool;
+    std::string* a = pool.create("alpha");
+    std::string* b = pool.create(3, 'x');
+
+    EXPECT_EQ(*a, "alpha");
+    EXPECT_EQ(*b, "xxx");
+    EXPECT_EQ(pool.liveCount(), 2u);
+
+    pool.destroy(a);
+    pool.destroy(b);
+    EXPECT_EQ(pool.liveCount(), 0u);
+}
+
+TEST(NodePoolTest, ReusesFreedSlots) {
+    NodePool<int, 4> pool;
+    int* a = pool.create(1);
+    pool.destroy(a);
+    int* b = pool.create(2);
+
+    EXPECT_EQ(a, b);
+    pool.destroy(b);
+}
+
+TEST(NodePoolTest, GrowsAcrossChunks) {
+    NodePool<int, 4> pool;
+    std::vector<int*> nodes;
+    for (int i = 0; i < 20; ++i) nodes.push_back(pool.create(i));
+    for (int i = 0; i < 20; ++i) EXPECT_EQ(*nodes[i], i);
+
+    EXPECT_EQ(pool.liveCount(), 20u);
+    EXPECT_EQ(pool.chunkCount(), 5u);
+    for (int* n : nodes) pool.destroy(n);
+}
+
+TEST(NodePoolTest, AbsorbTakesOverNodes) {
+    NodePool<int, 4> a, b;
+    int* x = a.create(1);
+    int* y = b.create(2);
+    b.destroy(b.create(3)); // leaves a free slot in b
+
+    a.absorb(b);
+    EXPECT_EQ(a.liveCount(), 2u);
+    EXPECT_EQ(b.liveCount(), 0u);
+
+    a.destroy(y); // created by b, destroyed through a
+    a.destroy(x);
+    EXPECT_EQ(a.liveCount(), 0u);
+}
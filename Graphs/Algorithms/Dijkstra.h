@@ -5,55 +5,94 @@
 
 #pragma once
 #include "../Structures/Graph.h"
+#include "../../Queues/IndexedPriorityQueue.h"
+#include "../../Queues/RadixHeap.h"
+#include "../../Queues/BucketQueue.h"
 #include <unordered_map>
-#include <queue>
-#include <limits>gi
+#include <limits>
 
 namespace dsa {
 
     /**
      * @brief Computes the shortest paths from a starting vertex to all other vertices using Dijkstra's algorithm.
      *
+     * Vertices are numbered 0..V-1 so distances live in flat arrays, and the
+     * frontier is a dsa::IndexedPriorityQueue: a vertex is in the heap at most once
+     * and improvements use decreaseKey, so the heap never exceeds V entries
+     * (a lazy-insertion heap grows to O(E)).
+     *
+     * Because edge weights are non-negative integers, the keys the frontier sees
+     * only ever increase, so the monotone integer queues can be swapped in:
+     *
+     *     dijkstra(graph, s);                   // 4-ary indexed heap (default)
+     *     dijkstra<RadixHeap<int>>(graph, s);   // radix heap
+     *     dijkstra<BucketQueue<int>>(graph, s); // Dial's buckets, best for small weights
+     *
+     * @tparam PQ The frontier queue. Any type with the dsa::IndexedPriorityQueue
+     *            interface (constructor taking a capacity, push, decreaseKey,
+     *            contains, top, pop, isEmpty) keyed by int.
      * @tparam T The type of the vertex (e.g., int, std::string).
      * @param graph A weighted graph with positive edge weights.
      * @param start The starting vertex for shortest path calculation.
      * @return A pair of maps:
      *         - distances: mapping from each vertex to its minimum distance from the start.
      *         - previous: mapping from each vertex to its predecessor in the shortest path.
+     * @throws std::invalid_argument if the start vertex is not in the graph.
      */
-    template<typename T>
+    template<typename PQ = IndexedPriorityQueue<int>, typename T>
     std::pair<std::unordered_map<T, int>, std::unordered_map<T, T>>
     dijkstra(const Graph<T>& graph, const T& start) {
-        using pii = std::pair<int, T>;   // (distance, vertex)
-        std::priority_queue<pii, std::vector<pii>, std::greater<>> pq;
+        if (!graph.hasVertex(start))
+            throw std::invalid_argument("Start vertex does not exist in the graph.");
 
-        std::unordered_map<T, int> dist; // (vertex, distance)
-        std::unordered_map<T, T> prev;   // (vertex, previous vertex)
+        constexpr int infinity = std::numeric_limits<int>::max();
+        constexpr size_t none = static_cast<size_t>(-1);
 
-        for (const T& vertex : graph.getAllVertices()) {
-            dist[vertex] = std::numeric_limits<int>::max();
+        // Number the vertices so the hot loop works on indices.
+        std::vector<T> vertices = graph.getAllVertices();
+        std::unordered_map<T, size_t> index;
+        index.reserve(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            index.emplace(vertices[i], i);
         }
 
-        dist[start] = 0;
-        pq.emplace(0, start);
+        std::vector<int> dist(vertices.size(), infinity);
+        std::vector<size_t> prev(vertices.size(), none);
+        std::vector<bool> settled(vertices.size(), false);
+        PQ pq(vertices.size());
 
-        while (!pq.empty()) {
-            auto [currDist, currV] = pq.top();
+        size_t source = index.at(start);
+        dist[source] = 0;
+        pq.push(source, 0);
+
+        while (!pq.isEmpty()) {
+            size_t u = pq.top();
             pq.pop();
+            settled[u] = true;
 
-            if (currDist > dist[currV]) continue;
+            for (const auto& [neighbor, weight] : graph.getNeighbors(vertices[u])) {
+                size_t v = index.find(neighbor)->second;
+                if (settled[v]) continue;
 
-            for (const auto& [neighbor, weight] : graph.getNeighbors(currV)) {
-                int newDist = dist[currV] + weight;
-                if (newDist < dist[neighbor]) {
-                    dist[neighbor] = newDist;
-                    prev[neighbor] = currV;
-                    pq.emplace(newDist, neighbor);
+                int newDist = dist[u] + weight;
+                if (newDist < dist[v]) {
+                    dist[v] = newDist;
+                    prev[v] = u;
+                    if (pq.contains(v)) pq.decreaseKey(v, newDist);
+                    else pq.push(v, newDist);
                 }
             }
         }
 
-        return {dist, prev};
+        std::unordered_map<T, int> distances; // (vertex, distance)
+        std::unordered_map<T, T> previous;    // (vertex, previous vertex)
+        distances.reserve(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            distances.emplace(vertices[i], dist[i]);
+            if (prev[i] != none) previous.emplace(vertices[i], vertices[prev[i]]);
+        }
+
+        return {distances, previous};
     }
 
-} // namespace dsa
\ No newline at end of file
+} // namespace dsa
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <random>
 #include "../Structures/Graph.h"
 #include "BFS.h"
 #include "DFS.h"
@@ -146,4 +147,49 @@ TEST(DijkstraTest, WeightedUndirectedGraph) {
     EXPECT_EQ(previous["A"], "");  // Start node has no previous
     EXPECT_EQ(previous["B"], "A");
     EXPECT_EQ(previous["C"], "B");
-}
\ No newline at end of file
+}
+
+TEST(DijkstraTest, DecreaseKeyFindsLongerCheaperPath) {
+    Graph<int> graph;
+    graph.addEdge(0, 1, 10);
+    graph.addEdge(0, 2, 1);
+    graph.addEdge(2, 3, 1);
+    graph.addEdge(3, 1, 1);
+    graph.addEdge(1, 4, 2);
+
+    auto [distances, previous] = dijkstra(graph, 0);
+
+    EXPECT_EQ(distances[1], 3);  // 0 -> 2 -> 3 -> 1
+    EXPECT_EQ(distances[4], 5);
+    EXPECT_EQ(previous[1], 3);
+    EXPECT_EQ(previous[4], 1);
+}
+
+TEST(DijkstraTest, UnreachableAndMissingStart) {
+    Graph<int> graph;
+    graph.addEdge(1, 2, 4);
+    graph.addVertex(3);
+
+    auto [distances, previous] = dijkstra(graph, 1);
+    EXPECT_EQ(distances[3], std::numeric_limits<int>::max());
+    EXPECT_EQ(previous.count(3), 0u);
+
+    EXPECT_THROW(dijkstra(graph, 99), std::invalid_argument);
+}
+
+TEST(DijkstraTest, MonotoneQueuesMatchIndexedHeap) {
+    std::mt19937 rng(2024);
+    Graph<int> graph;
+    for (int v = 0; v < 300; ++v) graph.addVertex(v);
+    for (int e = 0; e < 2000; ++e) {
+        graph.addEdge(static_cast<int>(rng() % 300), static_cast<int>(rng() % 300),
+                      static_cast<int>(rng() % 20) + 1);
+    }
+
+    auto heap   = dijkstra(graph, 0).first;
+    auto radix  = dijkstra<RadixHeap<int>>(graph, 0).first;
+    auto bucket = dijkstra<BucketQueue<int>>(graph, 0).first;
+
+    EXPECT_EQ(heap, radix);
+    EXPECT_EQ(heap, bucket);
+}
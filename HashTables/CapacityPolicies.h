@@ -0,0 +1,97 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace dsa {
+    /**
+     * Capacity policies for the chaining and open addressing tables.
+     *
+     * A policy decides which bucket counts a table may use and how a hash is
+     * reduced to a home bucket:
+     *   - normalize(n) returns the smallest allowed capacity >= n,
+     *   - grow(n) returns the capacity to move to from n,
+     *   - reduce(hash, capacity) maps a hash into [0, capacity).
+     *
+     * The power-of-two policies reduce without an integer division, which
+     * otherwise dominates the cost of a short probe. PrimeCapacity keeps the
+     * `%` reduction for schemes that rely on a prime table size.
+     */
+
+    /// @brief Power-of-two capacities; the home bucket is the low bits of the hash.
+    struct PowerOfTwoMask {
+        static size_t normalize(size_t capacity) {
+            return std::bit_ceil(std::max<size_t>(capacity, 1));
+        }
+
+        static size_t grow(size_t capacity) {
+            return capacity * 2;
+        }
+
+        static size_t reduce(size_t hash, size_t capacity) {
+            return hash & (capacity - 1);
+        }
+    };
+
+    /**
+     * @brief Power-of-two capacities with Fibonacci hashing.
+     *
+     * The hash is multiplied by 2^64/φ and the top log2(capacity) bits are kept,
+     * so every input bit influences the bucket. Weak hashes (identity, or ones
+     * whose low bits barely vary) then still spread well.
+     */
+    struct FibonacciReduce {
+        static size_t normalize(size_t capacity) {
+            return std::bit_ceil(std::max<size_t>(capacity, 1));
+        }
+
+        static size_t grow(size_t capacity) {
+            return capacity * 2;
+        }
+
+        static size_t reduce(size_t hash, size_t capacity) {
+            uint64_t product = static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+            // Shift in two steps so that capacity 1 (a shift by 64) stays defined.
+            return static_cast<size_t>((product >> (63 - std::countr_zero(capacity))) >> 1);
+        }
+    };
+
+    /**
+     * @brief Prime capacities, roughly doubling, with `%` reduction.
+     *
+     * Needed by double hashing with arbitrary step sizes: every step in
+     * [1, capacity) is coprime with a prime, so each probe sequence reaches
+     * every bucket.
+     */
+    struct PrimeCapacity {
+        static size_t normalize(size_t capacity) {
+            for (size_t prime : kPrimes) {
+                if (prime >= capacity) return prime;
+            }
+            return kPrimes[std::size(kPrimes) - 1];
+        }
+
+        static size_t grow(size_t capacity) {
+            return normalize(capacity * 2);
+        }
+
+        static size_t reduce(size_t hash, size_t capacity) {
+            return hash % capacity;
+        }
+
+    private:
+        // Each entry is the smallest prime above the previous entry times two.
+        static constexpr uint64_t kPrimes[] = {
+            2ull, 5ull, 11ull, 23ull, 47ull, 97ull, 197ull, 397ull, 797ull, 1597ull,
+            3203ull, 6421ull, 12853ull, 25717ull, 51437ull, 102877ull, 205759ull,
+            411527ull, 823117ull, 1646237ull, 3292489ull, 6584983ull, 13169977ull,
+            26339969ull, 52679969ull, 105359939ull, 210719881ull, 421439783ull,
+            842879579ull, 1685759167ull, 3371518343ull, 6743036717ull, 13486073473ull,
+            26972146961ull, 53944293929ull, 107888587883ull, 215777175787ull,
+            431554351609ull, 863108703229ull, 1726217406467ull,
+        };
+    };
+
+} // namespace dsa
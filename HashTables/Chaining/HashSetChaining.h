@@ -0,0 +1,43 @@
+#pragma once
+#include "HashTableChaining.h"
+#include "../SetValue.h"
+
+namespace dsa {
+    /**
+     * @brief A separate chaining hash set: HashTableChaining with no values.
+     *
+     * Each node holds the key, its cached hash and the next link, with no
+     * dummy value.
+     *
+     * @tparam K The key type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     * @tparam Capacity The capacity policy (PowerOfTwoMask, FibonacciReduce, PrimeCapacity).
+     */
+    template<typename K, typename Hash = Hash<K>, typename KeyEqual = std::equal_to<K>,
+             typename Capacity = PowerOfTwoMask>
+    class HashSetChaining
+      : private HashTableChaining<K, SetValue, Hash, KeyEqual, Capacity>
+    {
+    public:
+        using Base = HashTableChaining<K, SetValue, Hash, KeyEqual, Capacity>;
+        using Base::Base;  // Inherit constructors
+
+        using Base::remove;
+        using Base::size;
+        using Base::isEmpty;
+        using Base::bucketCount;
+        using Base::clear;
+        using Base::isRehashing;
+        using Base::stats;
+
+        /// @brief Adds a key. Returns false if it was already present. O(1) average.
+        bool insert(const K& key) { return Base::tryEmplace(key).second; }
+        bool insert(K&& key) { return Base::tryEmplace(std::move(key)).second; }
+
+        /// @brief Checks if a key is present. O(1) average.
+        bool contains(const K& key) const { return Base::containsKey(key); }
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        bool contains(const Q& key) const { return Base::containsKey(key); }
+    };
+} // namespace dsa
@@ -1,17 +1,24 @@
 #pragma once
+#include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include "../../LinkedLists/DoublyLinkedList.h"
+#include "../../Containers/NodePool.h"
+#include "../CapacityPolicies.h"
+#include "../Hash.h"
+#include "../HashTableStats.h"
 
 namespace dsa {
     /**
-     * @brief A simple key-value pair entry for the hash table.
+     * @brief A simple key-value pair entry for the hash table. An empty V
+     * (as in HashSetChaining) takes no space.
      */
     template<typename K, typename V>
     struct HashEntry {
         K key;
-        V value;
+        [[no_unique_address]] V value;
 
-        // Equality operator used by the linked list's find/remove operations.
+        // Equality compares keys only.
         bool operator==(const HashEntry& other) const {
             return key == other.key;
         }
@@ -20,35 +27,126 @@ namespace dsa {
     /**
      * @brief A hash table implementation using separate chaining for collision resolution.
      *
-     * Each bucket in the table is a dsa::DoublyLinkedList. When a collision occurs,
-     * the new entry is simply added to the list at that bucket index.
+     * Each bucket is a head pointer to a singly linked chain of nodes. Nodes
+     * come from a dsa::NodePool, so inserting costs no per-node heap allocation,
+     * and each node caches its key's full hash. Comparisons check the hash before
+     * the key, and resizing relinks the existing nodes into the new bucket array
+     * without rehashing keys or reallocating nodes.
+     *
+     * The bucket count and the hash-to-bucket reduction come from the `Capacity`
+     * policy (see CapacityPolicies.h). The default keeps power-of-two bucket
+     * counts and masks the hash, so finding a chain needs no division.
+     *
      * The average time complexity for insert, remove, and get is O(1 + α), where
-     * α is the load factor (size/capacity).
+     * α is the load factor (size/capacity). The bucket count doubles whenever α
+     * would exceed the maximum load factor.
+     *
+     * In incremental mode a resize only allocates the new bucket array; insert()
+     * and remove() then each move a few old chains across, and lookups check
+     * both arrays until the move completes, so no single call pays O(n).
+     *
+     * With a transparent Hash and KeyEqual (see TransparentLookup), get(),
+     * containsKey(), remove() and tryEmplace() take any compatible key type,
+     * e.g. std::string_view for std::string keys, without a temporary K.
      *
      * @tparam K The key type.
      * @tparam V The value type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     * @tparam Capacity The capacity policy (PowerOfTwoMask, FibonacciReduce, PrimeCapacity).
      */
-    template<typename K, typename V>
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>,
+        typename Capacity = PowerOfTwoMask
+    >
     class HashTableChaining {
     private:
         using Entry = HashEntry<K, V>;
 
-        std::vector<DoublyLinkedList<Entry>> buckets;
+        /// @brief A chain link: the entry, its cached hash, and the next node.
+        struct Node {
+            Entry  entry;
+            size_t hash;
+            Node*  next;
+
+            /// @brief Builds the key from `k` and the value from `args` in place.
+            template<typename KeyArg, typename... Args>
+            Node(size_t h, Node* n, KeyArg&& k, Args&&... args)
+                : entry{K(std::forward<KeyArg>(k)), V(std::forward<Args>(args)...)}, hash(h), next(n) {}
+        };
+
+        /// @brief Old chains moved per insert() or remove() while rehashing.
+        static constexpr size_t kMigrationStep = 8;
+
+        /// @brief Keys hashed and prefetched together by the batch operations.
+        static constexpr size_t kBatchGroup = 16;
+
+        std::vector<Node*> buckets;
+        std::vector<Node*> oldBuckets;      // Previous array while migrating, else empty.
+        size_t migrateCursor;               // Old chains below this have been moved.
         size_t numElements;
+        float maxLoadFactor;
+        bool incremental;
+        NodePool<Node> pool;
+        Hash hasher;
+        KeyEqual keyEqual;
+        [[no_unique_address]] RehashCounters rehashCounters; // Empty unless DSA_HASH_TABLE_STATS.
+
+        /// @brief True if a Q can be looked up as is, without first converting it to K.
+        template<typename Q>
+        static constexpr bool isLookupKey =
+            std::is_same_v<std::remove_cvref_t<Q>, K> || TransparentLookup<Hash, KeyEqual>;
+
+        /// @brief Returns the chain head for `hash` in a bucket array.
+        static Node*& headFor(std::vector<Node*>& table, size_t hash);
 
         /**
-         * @brief Computes the bucket index for a given key.
-         * @param key The key to hash.
-         * @return The index in the buckets vector.
+         * @brief Finds the link pointing at key's node in a bucket array.
+         * @return The link (bucket head or a node's next field), or nullptr if absent.
          */
-        size_t getBucketIndex(const K& key) const;
+        template<typename Q>
+        Node** findLink(std::vector<Node*>& table, const Q& key, size_t hash);
+
+        /// @brief Finds the node holding key in either bucket array, or nullptr.
+        template<typename Q>
+        Node* findNode(const Q& key, size_t hash) const;
+
+        /// @brief tryEmplace() for a lookup-ready key whose hash is known.
+        template<typename KeyArg, typename... Args>
+        std::pair<V*, bool> tryEmplaceHashed(size_t hash, KeyArg&& key, Args&&... args);
+
+        /// @brief Unlinks and destroys key's node, if any.
+        template<typename Q>
+        bool removeKey(const Q& key);
+
+        /// @brief Doubles the bucket count, all at once or by starting a migration.
+        void grow();
+
+        /// @brief Relinks up to `count` old chains into the current buckets.
+        void migrate(size_t count);
+
+        /// @brief Destroys every node of a bucket array and empties its buckets.
+        void destroyChains(std::vector<Node*>& table);
 
     public:
         /**
          * @brief Constructs the hash table.
-         * @param initialCapacity The initial number of buckets.
+         * @param initialCapacity The initial number of buckets, rounded up to one the capacity policy allows.
+         * @param maxLoadFactor The average chain length at which to grow.
+         * @param incrementalRehash Spread each resize across later operations.
          */
-        HashTableChaining(size_t initialCapacity = 16);
+        HashTableChaining(size_t initialCapacity = 16,
+                          float maxLoadFactor = 1.0f,
+                          bool incrementalRehash = false);
+
+        /// @brief Destroys all entries.
+        ~HashTableChaining();
+
+        HashTableChaining(const HashTableChaining&) = delete;
+        HashTableChaining& operator=(const HashTableChaining&) = delete;
 
         /**
          * @brief Inserts a key-value pair. If the key already exists, updates the value. O(1) average.
@@ -56,6 +154,32 @@ namespace dsa {
          * @param value The value of the element.
          */
         void insert(const K& key, const V& value);
+        void insert(K&& key, V&& value);
+
+        /**
+         * @brief Constructs a key and value from args (as for a std::pair<K, V>),
+         * then inserts them by move if the key is absent. Both are built even if
+         * the key exists; prefer tryEmplace() when that matters. O(1) average.
+         * @return The value for the key, and whether it was inserted.
+         */
+        template<typename... Args>
+        std::pair<V*, bool> emplace(Args&&... args);
+
+        /**
+         * @brief Inserts a value constructed in place from args if the key is absent.
+         * Nothing is constructed or moved from when the key exists. A transparent
+         * lookup key is converted to K only when it is inserted. O(1) average.
+         * @return The value for the key, and whether it was inserted.
+         */
+        template<typename KeyArg, typename... Args>
+        std::pair<V*, bool> tryEmplace(KeyArg&& key, Args&&... args);
+
+        /**
+         * @brief Inserts the key with `value`, or assigns `value` if the key exists. O(1) average.
+         * @return true if inserted, false if assigned.
+         */
+        template<typename KeyArg, typename M>
+        bool insertOrAssign(KeyArg&& key, M&& value);
 
         /**
          * @brief Removes a key-value pair. O(1) average.
@@ -63,6 +187,8 @@ namespace dsa {
          * @return true if the key was found and removed, false otherwise.
          */
         bool remove(const K& key);
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        bool remove(const Q& key);
 
         /**
          * @brief Retrieves a pointer to the value associated with a key. O(1) average.
@@ -70,6 +196,8 @@ namespace dsa {
          * @return A pointer to the value, or nullptr if the key is not found.
          */
         V* get(const K& key);
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        V* get(const Q& key);
 
         /**
          * @brief Checks if a key exists in the table. O(1) average.
@@ -77,13 +205,51 @@ namespace dsa {
          * @return true if the key exists, false otherwise.
          */
         bool containsKey(const K& key) const;
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        bool containsKey(const Q& key) const;
+
+        /**
+         * @brief Looks up n keys at once, overlapping their cache misses.
+         *
+         * Keys are handled in groups. A group is hashed and its bucket heads
+         * prefetched, then the heads are read and the first node of each chain
+         * prefetched, and only then are the chains compared. For tables larger
+         * than the cache the memory stalls of a group overlap instead of adding up.
+         * @param keys The n keys to find.
+         * @param n The number of keys.
+         * @param outValues Receives n pointers: each key's value, or nullptr if absent.
+         * @return The number of keys found.
+         */
+        size_t findBatch(const K* keys, size_t n, V** outValues);
+
+        /**
+         * @brief Inserts or updates n key-value pairs, prefetching bucket heads group
+         * by group. Without incremental rehashing the table is first grown to fit all n.
+         * @return The number of new keys inserted.
+         */
+        size_t insertBatch(const K* keys, const V* values, size_t n);
 
         /// @brief Returns the number of elements stored in the table. O(1).
         size_t size() const;
 
         /// @brief Checks if the table is empty. O(1).
         bool isEmpty() const;
+
+        /// @brief Returns the current number of buckets. O(1).
+        size_t bucketCount() const;
+
+        /// @brief Checks if an incremental migration is in progress. O(1).
+        bool isRehashing() const;
+
+        /**
+         * @brief Reports load and the chain-length distribution (see HashTableStats):
+         * an entry's probe length is its position in its chain. O(n + buckets).
+         */
+        HashTableStats stats() const;
+
+        /// @brief Removes all elements, keeping the bucket count. O(n + buckets).
+        void clear();
     };
 } // namespace dsa
 
-#include "HashTableChaining.tpp"
\ No newline at end of file
+#include "HashTableChaining.tpp"
@@ -1,82 +1,336 @@
 #include "HashTableChaining.h"
-#include "../Hash.h"
+#include <algorithm>
+#include "../Prefetch.h"
 
 namespace dsa {
-    // Get hash bucket index
-    template<typename K, typename V>
-    size_t HashTableChaining<K, V>::getBucketIndex(const K& key) const {
-        return Hash<K>{}(key) % buckets.size();
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    typename HashTableChaining<K, V, Hash, KeyEqual, Capacity>::Node*&
+    HashTableChaining<K, V, Hash, KeyEqual, Capacity>::headFor(std::vector<Node*>& table, size_t hash) {
+        return table[Capacity::reduce(hash, table.size())];
     }
 
     // Constructor
-    template<typename K, typename V>
-    HashTableChaining<K, V>::HashTableChaining(size_t initialCapacity) : buckets(initialCapacity), numElements(0) {}
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    HashTableChaining<K, V, Hash, KeyEqual, Capacity>::HashTableChaining(size_t initialCapacity, float maxLoadFactor, bool incrementalRehash)
+        : buckets(Capacity::normalize(initialCapacity), nullptr), migrateCursor(0), numElements(0),
+          maxLoadFactor(maxLoadFactor), incremental(incrementalRehash) {}
 
-    // Insert key-value pair
-    template<typename K, typename V>
-    void HashTableChaining<K, V>::insert(const K& key, const V& value) {
-        size_t bucketIndex = getBucketIndex(key);
-        Entry newEntry{key, value};
+    // Destructor
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    HashTableChaining<K, V, Hash, KeyEqual, Capacity>::~HashTableChaining() {
+        // The pool frees memory but leaves destruction to us.
+        destroyChains(buckets);
+        destroyChains(oldBuckets);
+    }
 
-        DoublyLinkedList<Entry>& bucket = buckets[bucketIndex];
-        typename DoublyLinkedList<Entry>::NodePtr node = bucket.find(newEntry);
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    void HashTableChaining<K, V, Hash, KeyEqual, Capacity>::destroyChains(std::vector<Node*>& table) {
+        for (Node*& head : table) {
+            while (head) {
+                Node* next = head->next;
+                pool.destroy(head);
+                head = next;
+            }
+        }
+    }
 
-        if (node != nullptr) {
-            node->data.value = value; // update
+    // Lookup helpers
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename Q>
+    typename HashTableChaining<K, V, Hash, KeyEqual, Capacity>::Node**
+    HashTableChaining<K, V, Hash, KeyEqual, Capacity>::findLink(std::vector<Node*>& table, const Q& key, size_t hash) {
+        Node** link = &headFor(table, hash);
+        while (*link) {
+            if ((*link)->hash == hash && keyEqual((*link)->entry.key, key)) return link;
+            link = &(*link)->next;
+        }
+        return nullptr;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename Q>
+    typename HashTableChaining<K, V, Hash, KeyEqual, Capacity>::Node*
+    HashTableChaining<K, V, Hash, KeyEqual, Capacity>::findNode(const Q& key, size_t hash) const {
+        for (Node* node = buckets[Capacity::reduce(hash, buckets.size())]; node; node = node->next) {
+            if (node->hash == hash && keyEqual(node->entry.key, key)) return node;
+        }
+        if (!oldBuckets.empty()) {
+            for (Node* node = oldBuckets[Capacity::reduce(hash, oldBuckets.size())]; node; node = node->next) {
+                if (node->hash == hash && keyEqual(node->entry.key, key)) return node;
+            }
+        }
+        return nullptr;
+    }
+
+    // Resizing
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    void HashTableChaining<K, V, Hash, KeyEqual, Capacity>::grow() {
+        migrate(oldBuckets.size()); // finish any migration first
+
+        {
+            RehashCounters::Scope timing(rehashCounters, true);
+            oldBuckets.swap(buckets);
+            buckets.assign(Capacity::grow(oldBuckets.size()), nullptr);
+            migrateCursor = 0;
+        }
+
+        if (!incremental) migrate(oldBuckets.size());
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    void HashTableChaining<K, V, Hash, KeyEqual, Capacity>::migrate(size_t count) {
+        if (oldBuckets.empty()) return;
+        RehashCounters::Scope timing(rehashCounters, false);
+
+        size_t end = std::min(oldBuckets.size(), migrateCursor + count);
+        for (; migrateCursor < end; ++migrateCursor) {
+            // Relink each node using its cached hash; nothing is copied.
+            Node* node = oldBuckets[migrateCursor];
+            oldBuckets[migrateCursor] = nullptr;
+            while (node) {
+                Node* next = node->next;
+                Node*& head = headFor(buckets, node->hash);
+                node->next = head;
+                head = node;
+                node = next;
+            }
+        }
+
+        if (migrateCursor == oldBuckets.size()) {
+            std::vector<Node*>().swap(oldBuckets);
+            migrateCursor = 0;
+        }
+    }
+
+    // Insertion
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename KeyArg, typename... Args>
+    std::pair<V*, bool> HashTableChaining<K, V, Hash, KeyEqual, Capacity>::tryEmplace(KeyArg&& key, Args&&... args) {
+        if constexpr (!isLookupKey<KeyArg>) {
+            // Not transparent: convert once and look up the real key.
+            return tryEmplace(K(std::forward<KeyArg>(key)), std::forward<Args>(args)...);
         } else {
-            bucket.append(newEntry); // insert new
-            ++numElements;
+            size_t hash = hasher(key);
+            return tryEmplaceHashed(hash, std::forward<KeyArg>(key), std::forward<Args>(args)...);
         }
     }
 
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename KeyArg, typename... Args>
+    std::pair<V*, bool> HashTableChaining<K, V, Hash, KeyEqual, Capacity>::tryEmplaceHashed(size_t hash, KeyArg&& key, Args&&... args) {
+        migrate(kMigrationStep);
+
+        Node* node = findNode(key, hash);
+        if (node != nullptr) return {&node->entry.value, false};
+
+        if ((numElements + 1.0f) / buckets.size() > maxLoadFactor) grow();
+        Node*& head = headFor(buckets, hash);
+        // insert new at the chain head, constructing key and value in the node
+        head = pool.create(hash, head, std::forward<KeyArg>(key), std::forward<Args>(args)...);
+        ++numElements;
+        return {&head->entry.value, true};
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename... Args>
+    std::pair<V*, bool> HashTableChaining<K, V, Hash, KeyEqual, Capacity>::emplace(Args&&... args) {
+        std::pair<K, V> entry(std::forward<Args>(args)...);
+        return tryEmplace(std::move(entry.first), std::move(entry.second));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename KeyArg, typename M>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::insertOrAssign(KeyArg&& key, M&& value) {
+        // tryEmplace leaves value untouched unless it inserts.
+        auto [slot, inserted] = tryEmplace(std::forward<KeyArg>(key), std::forward<M>(value));
+        if (!inserted) *slot = std::forward<M>(value); // update
+        return inserted;
+    }
+
+    // Insert key-value pair
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    void HashTableChaining<K, V, Hash, KeyEqual, Capacity>::insert(const K& key, const V& value) {
+        insertOrAssign(key, value);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    void HashTableChaining<K, V, Hash, KeyEqual, Capacity>::insert(K&& key, V&& value) {
+        insertOrAssign(std::move(key), std::move(value));
+    }
+
     // Remove key-value pair
-    template<typename K, typename V>
-    bool HashTableChaining<K, V>::remove(const K& key) {
-        size_t bucketIndex = getBucketIndex(key);
-        Entry target{key, V{}};
-        DoublyLinkedList<Entry>& bucket = buckets[bucketIndex];
-
-        if (bucket.contains(target)) {
-            bucket.remove(target);
-            --numElements;
-            return true;
-        }
-        return false;
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename Q>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::removeKey(const Q& key) {
+        migrate(kMigrationStep);
+
+        size_t hash = hasher(key);
+        Node** link = findLink(buckets, key, hash);
+        if (!link && !oldBuckets.empty()) link = findLink(oldBuckets, key, hash);
+        if (!link) return false;
+
+        Node* node = *link;
+        *link = node->next;
+        pool.destroy(node);
+        --numElements;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::remove(const K& key) {
+        return removeKey(key);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::remove(const Q& key) {
+        return removeKey(key);
     }
 
     // Get value from key
-    template<typename K, typename V>
-    V* HashTableChaining<K, V>::get(const K& key) {
-        size_t bucketIndex = getBucketIndex(key);
-        Entry target{key, V{}};
-        typename DoublyLinkedList<Entry>::NodePtr node = buckets[bucketIndex].find(target);
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    V* HashTableChaining<K, V, Hash, KeyEqual, Capacity>::get(const K& key) {
+        Node* node = findNode(key, hasher(key));
 
         if (node != nullptr) {
-            return &(node->data.value);
+            return &(node->entry.value);
         }
         return nullptr;
     }
 
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+    V* HashTableChaining<K, V, Hash, KeyEqual, Capacity>::get(const Q& key) {
+        Node* node = findNode(key, hasher(key));
+        return node ? &node->entry.value : nullptr;
+    }
+
     // Check if table contains entry with key
-    template<typename K, typename V>
-    bool HashTableChaining<K, V>::containsKey(const K& key) const {
-        size_t bucketIndex = getBucketIndex(key);
-        Entry target{key, V{}};
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::containsKey(const K& key) const {
+        return findNode(key, hasher(key)) != nullptr;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::containsKey(const Q& key) const {
+        return findNode(key, hasher(key)) != nullptr;
+    }
+
+    // Batch operations
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    size_t HashTableChaining<K, V, Hash, KeyEqual, Capacity>::findBatch(const K* keys, size_t n, V** outValues) {
+        size_t found = 0;
+        size_t hashes[kBatchGroup];
+        Node* heads[kBatchGroup];
+
+        for (size_t base = 0; base < n; base += kBatchGroup) {
+            size_t count = std::min(kBatchGroup, n - base);
 
-        const DoublyLinkedList<Entry>& bucket = buckets[bucketIndex];
-        return bucket.contains(target);
+            // Stage 1: hash the group and start loading each bucket's head pointer.
+            for (size_t i = 0; i < count; ++i) {
+                hashes[i] = hasher(keys[base + i]);
+                prefetchRead(&headFor(buckets, hashes[i]));
+            }
+
+            // Stage 2: read the heads and start loading the first node of each chain.
+            for (size_t i = 0; i < count; ++i) {
+                heads[i] = headFor(buckets, hashes[i]);
+                if (heads[i]) prefetchRead(heads[i]);
+            }
+
+            // Stage 3: walk the chains; most end at the already-loaded first node.
+            for (size_t i = 0; i < count; ++i) {
+                Node* node = heads[i];
+                while (node && !(node->hash == hashes[i] && keyEqual(node->entry.key, keys[base + i]))) {
+                    node = node->next;
+                }
+                if (!node && !oldBuckets.empty()) node = findNode(keys[base + i], hashes[i]);
+
+                outValues[base + i] = node ? &node->entry.value : nullptr;
+                if (node) ++found;
+            }
+        }
+        return found;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    size_t HashTableChaining<K, V, Hash, KeyEqual, Capacity>::insertBatch(const K* keys, const V* values, size_t n) {
+        if (!incremental) {
+            // Size for the whole batch up front, so no prefetched bucket moves mid-group.
+            while (numElements + n > maxLoadFactor * buckets.size()) grow();
+        }
+
+        size_t inserted = 0;
+        size_t hashes[kBatchGroup];
+
+        for (size_t base = 0; base < n; base += kBatchGroup) {
+            size_t count = std::min(kBatchGroup, n - base);
+
+            for (size_t i = 0; i < count; ++i) {
+                hashes[i] = hasher(keys[base + i]);
+                prefetchRead(&headFor(buckets, hashes[i]));
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                auto [slot, fresh] = tryEmplaceHashed(hashes[i], keys[base + i], values[base + i]);
+                if (fresh) ++inserted;
+                else *slot = values[base + i]; // update, as insert() does
+            }
+        }
+        return inserted;
     }
 
     // Get table size
-    template<typename K, typename V>
-    size_t HashTableChaining<K, V>::size() const {
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    size_t HashTableChaining<K, V, Hash, KeyEqual, Capacity>::size() const {
         return numElements;
     }
 
     // Check if table is empty
-    template<typename K, typename V>
-    bool HashTableChaining<K, V>::isEmpty() const {
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::isEmpty() const {
         return numElements == 0;
     }
 
-} // namespace dsa
\ No newline at end of file
+    // Get bucket count
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    size_t HashTableChaining<K, V, Hash, KeyEqual, Capacity>::bucketCount() const {
+        return buckets.size();
+    }
+
+    // Check for a migration in progress
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    bool HashTableChaining<K, V, Hash, KeyEqual, Capacity>::isRehashing() const {
+        return !oldBuckets.empty();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    HashTableStats HashTableChaining<K, V, Hash, KeyEqual, Capacity>::stats() const {
+        HashTableStats stats;
+        stats.size = numElements;
+        stats.capacity = buckets.size();
+        stats.loadFactor = static_cast<float>(numElements) / buckets.size();
+
+        for (const auto* table : {&buckets, &oldBuckets}) {
+            for (Node* head : *table) {
+                size_t position = 0;
+                for (Node* node = head; node; node = node->next) stats.recordProbe(++position);
+            }
+        }
+        stats.finishProbes();
+        rehashCounters.report(stats);
+        return stats;
+    }
+
+    // Remove everything
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Capacity>
+    void HashTableChaining<K, V, Hash, KeyEqual, Capacity>::clear() {
+        destroyChains(buckets);
+        destroyChains(oldBuckets);
+        std::vector<Node*>().swap(oldBuckets);
+        migrateCursor = 0;
+        numElements = 0;
+    }
+
+} // namespace dsa
@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 #include "HashTableChaining.h"
+#include "HashSetChaining.h"
 
 using namespace dsa;
 
@@ -64,11 +69,12 @@ TEST(HashTableChaining, ContainsKey) {
 }
 
 TEST(HashTableChaining, HandlesCollisions) {
-    // small capacity to force collisions: 4 buckets, so 1 and 5 collide
-    HashTableChaining<int,std::string> table(4);
+    // a single bucket with a high load factor: every key shares one chain
+    HashTableChaining<int,std::string> table(1, 8.0f);
     table.insert(1, "one");
     table.insert(5, "five");
-    table.insert(9, "nine");  // also 9%4 == 1
+    table.insert(9, "nine");
+    ASSERT_EQ(table.bucketCount(), 1u);
 
     EXPECT_EQ(*table.get(1), "one");
     EXPECT_EQ(*table.get(5), "five");
@@ -81,4 +87,228 @@ TEST(HashTableChaining, HandlesCollisions) {
     EXPECT_EQ(*table.get(1), "one");
     EXPECT_EQ(*table.get(9), "nine");
     EXPECT_EQ(table.size(), 2u);
-}
\ No newline at end of file
+}
+
+TEST(HashTableChaining, GrowsWithLoad) {
+    HashTableChaining<int,int> table(4);
+    for (int i = 0; i < 1000; ++i) table.insert(i, i * i);
+
+    EXPECT_GE(table.bucketCount(), 1000u);
+    EXPECT_FALSE(table.isRehashing());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NE(table.get(i), nullptr);
+        EXPECT_EQ(*table.get(i), i * i);
+    }
+}
+
+TEST(HashTableChaining, IncrementalRehashStaysConsistent) {
+    HashTableChaining<int,int> table(4, 1.0f, true);
+    bool sawMigration = false;
+
+    for (int i = 0; i < 5000; ++i) {
+        table.insert(i, i);
+        if (i % 3 == 0) table.insert(i / 2, -i); // update, possibly in the old array
+        if (i % 7 == 0) table.remove(i / 3);
+        sawMigration |= table.isRehashing();
+
+        // Every key must stay reachable mid-migration.
+        if (i % 500 == 0) {
+            for (int k = i / 3 + 1; k <= i; ++k) ASSERT_TRUE(table.containsKey(k)) << k;
+        }
+    }
+    EXPECT_TRUE(sawMigration);
+
+    size_t live = 0;
+    for (int k = 0; k < 5000; ++k) live += table.containsKey(k);
+    EXPECT_EQ(live, table.size());
+}
+
+TEST(HashTableChaining, ClearDestroysValuesAndAllowsReuse) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        HashTableChaining<int,std::shared_ptr<int>> table(2, 1.0f, true);
+        for (int i = 0; i < 300; ++i) table.insert(i, tracker);
+        EXPECT_EQ(tracker.use_count(), 301);
+
+        table.clear();
+        EXPECT_EQ(tracker.use_count(), 1);
+        EXPECT_TRUE(table.isEmpty());
+        EXPECT_FALSE(table.containsKey(5));
+
+        for (int i = 0; i < 50; ++i) table.insert(i, tracker);
+        for (int i = 0; i < 10; ++i) table.remove(i);
+    }
+    EXPECT_EQ(tracker.use_count(), 1); // the destructor released the rest
+}
+
+TEST(HashTableChaining, CapacityPolicies) {
+    HashTableChaining<int,int> masked(100);
+    EXPECT_EQ(masked.bucketCount(), 128u);
+
+    HashTableChaining<int,int,Hash<int>,std::equal_to<int>,PrimeCapacity> prime(100);
+    HashTableChaining<int,int,Hash<int>,std::equal_to<int>,FibonacciReduce> fib(3, 1.0f, true);
+    EXPECT_EQ(prime.bucketCount(), 197u);
+    EXPECT_EQ(fib.bucketCount(), 4u);
+
+    for (int i = 0; i < 2000; ++i) {
+        prime.insert(i, i);
+        fib.insert(i, i);
+    }
+    EXPECT_EQ(prime.bucketCount(), 3203u);
+    for (int i = 0; i < 2000; ++i) {
+        ASSERT_NE(prime.get(i), nullptr);
+        ASSERT_NE(fib.get(i), nullptr);
+        EXPECT_EQ(*fib.get(i), i);
+    }
+}
+
+namespace {
+    // A key that counts how many times it is constructed, with transparent
+    // functors that also accept a plain int id.
+    struct CountedKey {
+        static inline int constructed = 0;
+        int id;
+        explicit CountedKey(int i) : id(i) { ++constructed; }
+        CountedKey(const CountedKey& other) : id(other.id) { ++constructed; }
+        CountedKey(CountedKey&& other) noexcept : id(other.id) { ++constructed; }
+        CountedKey& operator=(const CountedKey&) = default;
+        CountedKey& operator=(CountedKey&&) = default;
+    };
+
+    struct CountedHash {
+        using is_transparent = void;
+        size_t operator()(const CountedKey& k) const { return Hash<int>{}(k.id); }
+        size_t operator()(int id) const { return Hash<int>{}(id); }
+    };
+
+    struct CountedEqual {
+        using is_transparent = void;
+        bool operator()(const CountedKey& a, const CountedKey& b) const { return a.id == b.id; }
+        bool operator()(const CountedKey& a, int id) const { return a.id == id; }
+    };
+}
+
+TEST(HashTableChaining, HeterogeneousLookupBuildsNoKeys) {
+    CountedKey::constructed = 0;
+    HashTableChaining<CountedKey,int,CountedHash,CountedEqual> table;
+    for (int i = 0; i < 100; ++i) table.tryEmplace(i, i * 3); // converts the id only on insert
+    EXPECT_EQ(CountedKey::constructed, 100);
+
+    CountedKey::constructed = 0;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_NE(table.get(i), nullptr);
+        EXPECT_EQ(*table.get(i), i * 3);
+        EXPECT_TRUE(table.containsKey(i));
+        EXPECT_FALSE(table.tryEmplace(i, -1).second);
+    }
+    EXPECT_TRUE(table.remove(7));
+    EXPECT_FALSE(table.containsKey(7));
+    EXPECT_EQ(CountedKey::constructed, 0);
+}
+
+TEST(HashTableChaining, StringViewLookupOnStringKeys) {
+    HashTableChaining<std::string,int,Hash<std::string>,std::equal_to<>> table;
+    table.insert("alpha", 1);
+    std::string_view view = "alpha";
+    ASSERT_NE(table.get(view), nullptr);
+    EXPECT_EQ(*table.get(view), 1);
+    EXPECT_TRUE(table.remove(view));
+    EXPECT_FALSE(table.containsKey("alpha"));
+}
+
+TEST(HashTableChaining, EmplaceTryEmplaceInsertOrAssign) {
+    HashTableChaining<std::string,std::unique_ptr<int>> table;
+
+    auto [value, inserted] = table.tryEmplace("a", std::make_unique<int>(1));
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(**value, 1);
+
+    auto pending = std::make_unique<int>(2);
+    EXPECT_FALSE(table.tryEmplace("a", std::move(pending)).second);
+    ASSERT_NE(pending, nullptr); // not moved from when the key exists
+
+    EXPECT_TRUE(table.emplace("b", std::make_unique<int>(3)).second);
+    EXPECT_FALSE(table.insertOrAssign(std::string("a"), std::make_unique<int>(4)));
+    EXPECT_TRUE(table.insertOrAssign("c", std::make_unique<int>(5)));
+    table.insert(std::string("d"), std::make_unique<int>(6)); // move-only value
+
+    EXPECT_EQ(**table.get("a"), 4);
+    EXPECT_EQ(**table.get("b"), 3);
+    EXPECT_EQ(**table.get("c"), 5);
+    EXPECT_EQ(**table.get("d"), 6);
+    EXPECT_EQ(table.size(), 4u);
+}
+
+TEST(HashTableChaining, FindBatchAndInsertBatch) {
+    for (bool incremental : {false, true}) {
+        HashTableChaining<int,int> table(4, 1.0f, incremental);
+        std::vector<int> keys(1000), values(1000);
+        for (int i = 0; i < 1000; ++i) {
+            keys[i] = i * 7;
+            values[i] = i;
+        }
+        EXPECT_EQ(table.insertBatch(keys.data(), values.data(), 600), 600u);
+        EXPECT_EQ(table.insertBatch(keys.data() + 500, values.data() + 500, 500), 400u); // 100 updates
+        EXPECT_EQ(table.size(), 1000u);
+
+        std::vector<int> probes;
+        for (int i = 0; i < 2000; ++i) probes.push_back(i * 7);  // half are absent
+        std::vector<int*> out(probes.size());
+        EXPECT_EQ(table.findBatch(probes.data(), probes.size(), out.data()), 1000u);
+        for (int i = 0; i < 2000; ++i) {
+            if (i < 1000) {
+                ASSERT_NE(out[i], nullptr);
+                EXPECT_EQ(*out[i], i);
+            } else {
+                EXPECT_EQ(out[i], nullptr);
+            }
+        }
+    }
+}
+
+TEST(HashTableChaining, StatsDescribeChains) {
+    // One bucket: every entry shares a chain, at positions 1..5.
+    HashTableChaining<int, int> single(1, 8.0f);
+    for (int i = 0; i < 5; ++i) single.insert(i, i);
+    HashTableStats stats = single.stats();
+    EXPECT_EQ(stats.size, 5u);
+    EXPECT_EQ(stats.capacity, 1u);
+    EXPECT_FLOAT_EQ(stats.loadFactor, 5.0f);
+    EXPECT_EQ(stats.tombstones, 0u);
+    EXPECT_EQ(stats.maxProbeLength, 5u);
+    EXPECT_DOUBLE_EQ(stats.meanProbeLength, 3.0);
+    EXPECT_EQ(stats.probeHistogram, (std::vector<size_t>{1, 1, 1, 1, 1}));
+
+    HashTableChaining<int, int> table(4);
+    for (int i = 0; i < 1000; ++i) table.insert(i, i);
+    stats = table.stats();
+    size_t counted = 0;
+    for (size_t n : stats.probeHistogram) counted += n;
+    EXPECT_EQ(counted, 1000u);
+    EXPECT_LT(stats.meanProbeLength, 2.0);
+#if DSA_HASH_TABLE_STATS
+    EXPECT_EQ(stats.rehashCount, 8u); // 4 -> 1024 buckets
+    EXPECT_GT(stats.rehashTime.count(), 0);
+#else
+    EXPECT_EQ(stats.rehashCount, 0u);
+#endif
+}
+
+TEST(HashSetChaining, InsertContainsRemove) {
+    HashSetChaining<std::string, Hash<std::string>, std::equal_to<>> set(2);
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_TRUE(set.insert("a"));
+    EXPECT_FALSE(set.insert("a"));
+    EXPECT_TRUE(set.contains("a"));
+    EXPECT_TRUE(set.contains(std::string_view("a")));
+    EXPECT_FALSE(set.contains("b"));
+
+    for (int i = 0; i < 500; ++i) set.insert("key" + std::to_string(i));
+    EXPECT_EQ(set.size(), 501u);
+    EXPECT_GE(set.bucketCount(), 501u);
+    EXPECT_TRUE(set.remove("key7"));
+    EXPECT_FALSE(set.contains("key7"));
+
+    set.clear();
+    EXPECT_TRUE(set.isEmpty());
+}
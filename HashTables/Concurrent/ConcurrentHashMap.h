@@ -0,0 +1,124 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../Hash.h"
+#include "../OpenAddressing/LinearProbingHashTable.h"
+
+namespace dsa {
+    /**
+     * @brief A thread-safe hash map split into independently locked shards.
+     *
+     * Keys are spread over a power-of-two number of shards by the top bits of
+     * their (mixed) hash; the table inside each shard uses the low bits, so the
+     * two choices stay independent. Each shard is an open addressing table
+     * guarded by its own std::shared_mutex: lookups on a shard take it shared
+     * and run in parallel, writers take it exclusively and only block that
+     * shard. Shards grow on their own, so a resize stalls 1/N of the keys, and
+     * with incremental rehashing not even those for long.
+     *
+     * Values are returned by copy (find) or touched through a callback under
+     * the lock (update), never by pointer, since another thread may move them.
+     *
+     * @tparam K The key type.
+     * @tparam V The value type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     * @tparam Table The per-shard table; any table built on HashTableOpenAddressingBase.
+     */
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>,
+        typename Table    = LinearProbingHashTable<K, V, Hash, KeyEqual>
+    >
+    class ConcurrentHashMap {
+    public:
+        /**
+         * @brief Constructs an empty map.
+         * @param shardCount Number of shards, rounded up to a power of two.
+         *        0 means four per hardware thread.
+         * @param shardCapacity Initial bucket count of each shard.
+         * @param maxLoadFactor Load factor at which a shard grows.
+         * @param incrementalRehash Spread each shard's resizes across its later writes.
+         */
+        explicit ConcurrentHashMap(size_t shardCount = 0,
+                                   size_t shardCapacity = 16,
+                                   float maxLoadFactor = 0.5f,
+                                   bool incrementalRehash = false);
+
+        ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+        ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+        /// @brief Inserts a key/value pair. Returns false if key already exists.
+        bool insert(const K& key, const V& value);
+
+        /// @brief Inserts the pair, or assigns the value if the key exists.
+        /// @return true if inserted, false if assigned.
+        bool insertOrAssign(const K& key, const V& value);
+
+        /// @brief Removes a key. Returns false if not found.
+        bool remove(const K& key);
+
+        /**
+         * @brief Copies the value of a key into out, under a shared lock.
+         * @return false if the key is absent; out is then unchanged.
+         */
+        bool find(const K& key, V& out) const;
+
+        /// @brief Checks if a key is present.
+        bool contains(const K& key) const;
+
+        /**
+         * @brief Calls fn(V&) on a key's value while holding its shard exclusively,
+         * for read-modify-write updates such as counters.
+         * @return false if the key is absent; fn is then not called.
+         */
+        template<typename Fn>
+        bool update(const K& key, Fn&& fn);
+
+        /// @brief Returns the number of elements. Exact only while no writer runs.
+        size_t size() const;
+
+        /// @brief Checks if the map is empty. Exact only while no writer runs.
+        bool isEmpty() const;
+
+        /// @brief Removes all elements, one shard at a time.
+        void clear();
+
+        /// @brief Returns the number of shards. O(1).
+        size_t shardCount() const;
+
+    private:
+        /**
+         * @brief One lock and its table, padded so neighbouring shards' locks
+         * do not share a cache line.
+         */
+        struct alignas(64) Shard {
+            mutable std::shared_mutex mutex;
+            Table table;
+
+            Shard(size_t capacity, float maxLoadFactor, bool incremental)
+                : table(capacity, maxLoadFactor, incremental) {}
+        };
+
+        std::vector<std::unique_ptr<Shard>> shards_;
+        unsigned                            shardShift_;  // 64 - log2(shard count)
+        Hash                                hasher_;
+
+        /// @brief Returns the shard responsible for key.
+        Shard& shardFor(const K& key) const;
+    };
+
+} // namespace dsa
+
+#include "ConcurrentHashMap.tpp"
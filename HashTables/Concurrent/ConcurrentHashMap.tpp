@@ -0,0 +1,106 @@
+namespace dsa {
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::ConcurrentHashMap(
+        size_t shardCount, size_t shardCapacity, float maxLoadFactor, bool incrementalRehash)
+    {
+        if (shardCount == 0) shardCount = 4 * std::max(1u, std::thread::hardware_concurrency());
+        shardCount = std::bit_ceil(shardCount);
+
+        shards_.reserve(shardCount);
+        for (size_t i = 0; i < shardCount; ++i) {
+            shards_.push_back(std::make_unique<Shard>(shardCapacity, maxLoadFactor, incrementalRehash));
+        }
+        // A shift by 64 would be undefined; one shard is handled in shardFor.
+        shardShift_ = 64 - static_cast<unsigned>(std::countr_zero(shardCount));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    typename ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::Shard&
+    ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::shardFor(const K& key) const {
+        if (shards_.size() == 1) return *shards_[0];
+        uint64_t h = hashing::mix64(static_cast<uint64_t>(hasher_(key)));
+        return *shards_[static_cast<size_t>(h >> shardShift_)];
+    }
+
+    // Writers
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::insert(const K& key, const V& value) {
+        Shard& shard = shardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.table.insert(key, value);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::insertOrAssign(const K& key, const V& value) {
+        Shard& shard = shardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.table.insertOrAssign(key, value);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::remove(const K& key) {
+        Shard& shard = shardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.table.remove(key);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    template<typename Fn>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::update(const K& key, Fn&& fn) {
+        Shard& shard = shardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        V* value = shard.table.find(key);
+        if (!value) return false;
+        fn(*value);
+        return true;
+    }
+
+    // Readers
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::find(const K& key, V& out) const {
+        const Shard& shard = shardFor(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const V* value = std::as_const(shard.table).find(key);
+        if (!value) return false;
+        out = *value;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::contains(const K& key) const {
+        const Shard& shard = shardFor(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return std::as_const(shard.table).find(key) != nullptr;
+    }
+
+    // Whole-map operations
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    size_t ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::size() const {
+        size_t total = 0;
+        for (const auto& shard : shards_) {
+            std::shared_lock<std::shared_mutex> lock(shard->mutex);
+            total += shard->table.size();
+        }
+        return total;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    bool ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::isEmpty() const {
+        return size() == 0;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    void ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::clear() {
+        for (auto& shard : shards_) {
+            std::unique_lock<std::shared_mutex> lock(shard->mutex);
+            shard->table.clear();
+        }
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Table>
+    size_t ConcurrentHashMap<K, V, Hash, KeyEqual, Table>::shardCount() const {
+        return shards_.size();
+    }
+
+} // namespace dsa
@@ -0,0 +1,127 @@
+#include "EpochReclamation.h"
+
+namespace dsa {
+
+    struct alignas(64) EpochDomain::Record {
+        std::atomic<uint64_t> epoch{kIdle};    // announced epoch, or kIdle
+        std::atomic<bool>     claimed{true};   // owned by a live thread
+        unsigned              depth = 0;       // owner-only: nested guards
+        Record*               next = nullptr;
+    };
+
+    EpochDomain& EpochDomain::global() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain::~EpochDomain() {
+        for (const Retired& r : retired_) r.deleter(r.object);
+        Record* record = records_.load();
+        while (record) {
+            Record* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    EpochDomain::Record& EpochDomain::localRecord() {
+        // Hands the record back when the thread exits.
+        struct Handle {
+            Record* record = nullptr;
+            ~Handle() {
+                if (record) record->claimed.store(false, std::memory_order_release);
+            }
+        };
+        thread_local Handle handle;
+        if (handle.record) return *handle.record;
+
+        // Reuse a record released by a finished thread before allocating.
+        for (Record* r = records_.load(std::memory_order_acquire); r; r = r->next) {
+            bool expected = false;
+            if (r->claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                handle.record = r;
+                return *r;
+            }
+        }
+
+        Record* record = new Record;
+        record->next = records_.load(std::memory_order_relaxed);
+        while (!records_.compare_exchange_weak(record->next, record,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {}
+        handle.record = record;
+        return *record;
+    }
+
+    EpochDomain::Guard EpochDomain::pin() {
+        Record& record = localRecord();
+        if (record.depth++ == 0) {
+            record.epoch.store(epoch_.load(), std::memory_order_relaxed);
+            // Pairs with the fence in tryAdvance(): either the advancing thread
+            // sees this announcement, or every load after it sees the unlinks
+            // that preceded the advance.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        return Guard(&record);
+    }
+
+    EpochDomain::Guard::~Guard() {
+        if (--record_->depth == 0) {
+            record_->epoch.store(kIdle, std::memory_order_release);
+        }
+    }
+
+    void EpochDomain::retire(void* object, void (*deleter)(void*)) {
+        // Orders the caller's unlink before the tag is read: a reader that
+        // announces a later epoch is then guaranteed to see the unlink.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        retired_.push_back({object, deleter, epoch_.load()});
+        if (++sinceReclaim_ >= kReclaimInterval) {
+            sinceReclaim_ = 0;
+            tryAdvance();
+            collect();
+        }
+    }
+
+    size_t EpochDomain::reclaim() {
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        // Two steps are enough to free everything retired so far if no reader is pinned.
+        if (tryAdvance()) tryAdvance();
+        return collect();
+    }
+
+    size_t EpochDomain::pendingCount() const {
+        std::lock_guard<std::mutex> lock(retireMutex_);
+        return retired_.size();
+    }
+
+    bool EpochDomain::tryAdvance() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint64_t current = epoch_.load();
+        for (Record* r = records_.load(std::memory_order_acquire); r; r = r->next) {
+            // Acquire pairs with the unpin store, so the reader's accesses precede any free.
+            uint64_t announced = r->epoch.load(std::memory_order_acquire);
+            if (announced != kIdle && announced != current) return false;
+        }
+        epoch_.store(current + 1);
+        return true;
+    }
+
+    size_t EpochDomain::collect() {
+        uint64_t current = epoch_.load();
+        size_t freed = 0;
+        for (size_t i = 0; i < retired_.size();) {
+            if (retired_[i].epoch + 2 <= current) {
+                retired_[i].deleter(retired_[i].object);
+                retired_[i] = retired_.back();
+                retired_.pop_back();
+                ++freed;
+            } else {
+                ++i;
+            }
+        }
+        return freed;
+    }
+
+} // namespace dsa
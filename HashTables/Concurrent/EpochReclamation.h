@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief Epoch-based reclamation for lock-free readers.
+     *
+     * A reader pins the domain for the duration of a lookup, announcing the
+     * current global epoch. A writer that unlinks an object retires it rather
+     * than deleting it; the object is tagged with the epoch it was retired in
+     * and freed only after the global epoch has moved two steps past that tag.
+     * The epoch only advances once every pinned thread has announced the
+     * current one, so by then no reader can still hold a pointer it found
+     * before the unlink.
+     *
+     * Pinning costs one store and one fence on a per-thread record and never
+     * blocks. Readers stalled inside a pin only delay reclamation.
+     *
+     * There is a single process-wide domain; every thread gets a record the
+     * first time it pins, and hands it back for reuse when it exits.
+     */
+    class EpochDomain {
+        struct Record;
+
+    public:
+        /**
+         * @brief Keeps the calling thread pinned while alive. Guards may nest.
+         */
+        class Guard {
+        public:
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+            ~Guard();
+
+        private:
+            friend class EpochDomain;
+            explicit Guard(Record* record) : record_(record) {}
+            Record* record_;
+        };
+
+        /// @brief Returns the process-wide domain.
+        static EpochDomain& global();
+
+        EpochDomain(const EpochDomain&) = delete;
+        EpochDomain& operator=(const EpochDomain&) = delete;
+        ~EpochDomain();
+
+        /// @brief Pins the calling thread; pointers loaded while pinned stay valid.
+        [[nodiscard]] Guard pin();
+
+        /**
+         * @brief Schedules object for deletion once no pinned reader can see it.
+         * The caller must already have unlinked it from every shared location.
+         */
+        template<typename T>
+        void retire(T* object) {
+            retire(object, [](void* p) { delete static_cast<T*>(p); });
+        }
+
+        /// @brief Type-erased form of retire(T*).
+        void retire(void* object, void (*deleter)(void*));
+
+        /**
+         * @brief Advances the epoch as far as pinned readers allow and frees
+         * whatever has become safe. retire() also does this periodically.
+         * @return The number of objects freed.
+         */
+        size_t reclaim();
+
+        /// @brief Returns the number of retired objects not yet freed.
+        size_t pendingCount() const;
+
+    private:
+        static constexpr uint64_t kIdle = UINT64_MAX;   // announced by unpinned threads
+
+        /// @brief Retire this many objects between automatic reclaim() passes.
+        static constexpr size_t kReclaimInterval = 64;
+
+        struct Retired {
+            void*    object;
+            void   (*deleter)(void*);
+            uint64_t epoch;
+        };
+
+        std::atomic<uint64_t> epoch_{0};
+        std::atomic<Record*>  records_{nullptr};   // push-only list of every thread record
+
+        mutable std::mutex    retireMutex_;
+        std::vector<Retired>  retired_;
+        size_t                sinceReclaim_ = 0;
+
+        EpochDomain() = default;
+
+        /// @brief Returns the calling thread's record, claiming one on first use.
+        Record& localRecord();
+
+        /// @brief Bumps the epoch if every pinned thread has seen the current one.
+        bool tryAdvance();
+
+        /// @brief Frees retired objects two epochs old. Caller holds retireMutex_.
+        size_t collect();
+    };
+
+} // namespace dsa
@@ -0,0 +1,143 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "EpochReclamation.h"
+#include "../CapacityPolicies.h"
+#include "../Hash.h"
+#include "../OpenAddressing/ProbePolicies.h"
+
+namespace dsa {
+    /**
+     * @brief A hash map for read-dominated workloads: lookups take no locks and
+     * finish in a bounded number of steps, whatever writers are doing.
+     *
+     * The layout follows HashTableOpenAddressingBase (power-of-two buckets, a
+     * probe policy, tombstones on removal), except that each bucket is an
+     * atomic pointer to an immutable entry. Writers never modify an entry in
+     * place: an assignment publishes a new entry into the bucket, a removal
+     * publishes a tombstone, and the displaced entry is retired to the
+     * EpochDomain. A resize builds a new bucket array from the live entries and
+     * publishes it with one pointer store; readers already probing the old
+     * array finish there, and it is retired the same way.
+     *
+     * find() therefore pins the epoch, loads the array and probes with plain
+     * acquire loads, at most capacity steps. Writers serialize on one mutex
+     * and only ever wait for each other, never for readers.
+     *
+     * @tparam K The key type.
+     * @tparam V The value type; find() copies it out.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     * @tparam Probe The probe policy (see ProbePolicies.h).
+     */
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>,
+        typename Probe    = LinearProbe
+    >
+    class ReadMostlyHashMap {
+    public:
+        /**
+         * @brief Constructs an empty map.
+         * @param capacity Initial bucket count, rounded up to a power of two.
+         * @param maxLoadFactor Live entries plus tombstones per bucket that trigger a rebuild.
+         */
+        explicit ReadMostlyHashMap(size_t capacity = 16, float maxLoadFactor = 0.5f);
+
+        /// @brief Frees every entry. No thread may be using the map.
+        ~ReadMostlyHashMap();
+
+        ReadMostlyHashMap(const ReadMostlyHashMap&) = delete;
+        ReadMostlyHashMap& operator=(const ReadMostlyHashMap&) = delete;
+
+        /// @brief Inserts a key/value pair. Returns false if key already exists.
+        bool insert(const K& key, const V& value);
+
+        /// @brief Inserts the pair, or replaces the value if the key exists.
+        /// @return true if inserted, false if assigned.
+        bool insertOrAssign(const K& key, const V& value);
+
+        /// @brief Removes a key. Returns false if not found.
+        bool remove(const K& key);
+
+        /**
+         * @brief Copies the value of a key into out. Takes no locks.
+         *
+         * Wait-free once the calling thread has pinned before; its first pin
+         * allocates and registers an epoch record.
+         * @return false if the key is absent; out is then unchanged.
+         */
+        bool find(const K& key, V& out) const;
+
+        /// @brief Checks if a key is present. Takes no locks; wait-free after the first pin, as find().
+        bool contains(const K& key) const;
+
+        /// @brief Returns the number of elements. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the map is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Returns the current bucket count.
+        size_t capacity() const;
+
+        /// @brief Removes all elements, keeping the capacity.
+        void clear();
+
+    private:
+        /// @brief An immutable key/value pair with its cached hash.
+        struct Entry {
+            K      key;
+            V      value;
+            size_t hash;
+        };
+
+        /// @brief A bucket array. Owns the array only; entries are shared across rebuilds.
+        struct Table {
+            size_t                                capacity;
+            std::unique_ptr<std::atomic<Entry*>[]> slots;
+
+            explicit Table(size_t cap);
+        };
+
+        /// @brief Marks a removed entry; never dereferenced.
+        static Entry* tombstone() { return reinterpret_cast<Entry*>(uintptr_t{1}); }
+
+        std::atomic<Table*> table_;
+        std::atomic<size_t> size_{0};
+        size_t              used_ = 0;        // writer-only: live entries plus tombstones
+        float               maxLoadFactor_;
+        std::mutex          writeMutex_;
+        Hash                hasher_;
+        KeyEqual            keyEqual_;
+
+        /// @brief Returns the entry for key in table, or nullptr. Caller is pinned or a writer.
+        Entry* lookup(const Table& table, const K& key, size_t hash) const;
+
+        /**
+         * @brief Writer-side probe: the bucket holding key, or the first reusable
+         * bucket (empty or tombstone) if key is absent.
+         * @param found Set to whether key was present.
+         */
+        size_t locate(const Table& table, const K& key, size_t hash, bool& found) const;
+
+        /// @brief Publishes a new bucket array of newCapacity holding the live entries.
+        void rebuild(size_t newCapacity);
+
+        /**
+         * @brief Shared body of insert and insertOrAssign, under the write lock.
+         * @param assign Whether to replace the value of an existing key.
+         * @return true if a new entry was added.
+         */
+        bool upsert(const K& key, const V& value, bool assign);
+    };
+
+} // namespace dsa
+
+#include "ReadMostlyHashMap.tpp"
@@ -0,0 +1,187 @@
+namespace dsa {
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::Table::Table(size_t cap)
+        : capacity(cap), slots(new std::atomic<Entry*>[cap])
+    {
+        for (size_t i = 0; i < cap; ++i) slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::ReadMostlyHashMap(size_t capacity, float maxLoadFactor)
+        : table_(new Table(PowerOfTwoMask::normalize(capacity))), maxLoadFactor_(maxLoadFactor) {}
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::~ReadMostlyHashMap() {
+        Table* table = table_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < table->capacity; ++i) {
+            Entry* entry = table->slots[i].load(std::memory_order_relaxed);
+            if (entry && entry != tombstone()) delete entry;
+        }
+        delete table;
+    }
+
+    // Probing
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    typename ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::Entry*
+    ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::lookup(const Table& table, const K& key, size_t hash) const {
+        typename Probe::Sequence seq(PowerOfTwoMask::reduce(hash, table.capacity), hash, table.capacity);
+        for (size_t step = 0; step < table.capacity; ++step, seq.next()) {
+            Entry* entry = table.slots[seq.index()].load(std::memory_order_acquire);
+            if (!entry) return nullptr;
+            if (entry != tombstone() && entry->hash == hash && keyEqual_(entry->key, key)) return entry;
+        }
+        return nullptr;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    size_t ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::locate(const Table& table, const K& key,
+                                                                  size_t hash, bool& found) const {
+        typename Probe::Sequence seq(PowerOfTwoMask::reduce(hash, table.capacity), hash, table.capacity);
+        size_t firstFree = table.capacity;
+        for (size_t step = 0; step < table.capacity; ++step, seq.next()) {
+            Entry* entry = table.slots[seq.index()].load(std::memory_order_relaxed);
+            if (!entry) {
+                found = false;
+                return firstFree != table.capacity ? firstFree : seq.index();
+            }
+            if (entry == tombstone()) {
+                if (firstFree == table.capacity) firstFree = seq.index();
+            } else if (entry->hash == hash && keyEqual_(entry->key, key)) {
+                found = true;
+                return seq.index();
+            }
+        }
+        // Every bucket holds a live entry (possible when maxLoadFactor >= 1):
+        // firstFree is still table.capacity, and the caller must rebuild.
+        found = false;
+        return firstFree;
+    }
+
+    // Readers
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::find(const K& key, V& out) const {
+        auto guard = EpochDomain::global().pin();
+        const Table* table = table_.load(std::memory_order_acquire);
+        const Entry* entry = lookup(*table, key, hasher_(key));
+        if (!entry) return false;
+        out = entry->value;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::contains(const K& key) const {
+        auto guard = EpochDomain::global().pin();
+        const Table* table = table_.load(std::memory_order_acquire);
+        return lookup(*table, key, hasher_(key)) != nullptr;
+    }
+
+    // Writers
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    void ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::rebuild(size_t newCapacity) {
+        Table* old = table_.load(std::memory_order_relaxed);
+        Table* fresh = new Table(newCapacity);
+        for (size_t i = 0; i < old->capacity; ++i) {
+            Entry* entry = old->slots[i].load(std::memory_order_relaxed);
+            if (!entry || entry == tombstone()) continue;
+            typename Probe::Sequence seq(PowerOfTwoMask::reduce(entry->hash, newCapacity), entry->hash, newCapacity);
+            while (fresh->slots[seq.index()].load(std::memory_order_relaxed)) seq.next();
+            fresh->slots[seq.index()].store(entry, std::memory_order_relaxed);
+        }
+        used_ = size_.load(std::memory_order_relaxed);
+        table_.store(fresh, std::memory_order_release);
+        EpochDomain::global().retire(old);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::upsert(const K& key, const V& value, bool assign) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        size_t hash = hasher_(key);
+        Table* table = table_.load(std::memory_order_relaxed);
+        bool found;
+        size_t index = locate(*table, key, hash, found);
+
+        if (found) {
+            if (!assign) return false;
+            Entry* old = table->slots[index].load(std::memory_order_relaxed);
+            table->slots[index].store(new Entry{key, value, hash}, std::memory_order_release);
+            EpochDomain::global().retire(old);
+            return false;
+        }
+
+        bool full = index == table->capacity;
+        bool reusesTombstone = !full && table->slots[index].load(std::memory_order_relaxed) != nullptr;
+        if (full || (!reusesTombstone && used_ + 1 > maxLoadFactor_ * table->capacity)) {
+            // Grow if live entries fill half the budget, otherwise just drop tombstones.
+            size_t live = size_.load(std::memory_order_relaxed) + 1;
+            rebuild(live > maxLoadFactor_ * table->capacity / 2 ? PowerOfTwoMask::grow(table->capacity)
+                                                                : table->capacity);
+            table = table_.load(std::memory_order_relaxed);
+            index = locate(*table, key, hash, found);
+        }
+
+        if (!table->slots[index].load(std::memory_order_relaxed)) ++used_;
+        table->slots[index].store(new Entry{key, value, hash}, std::memory_order_release);
+        size_.store(size_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::insert(const K& key, const V& value) {
+        return upsert(key, value, false);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::insertOrAssign(const K& key, const V& value) {
+        return upsert(key, value, true);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::remove(const K& key) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        Table* table = table_.load(std::memory_order_relaxed);
+        bool found;
+        size_t index = locate(*table, key, hasher_(key), found);
+        if (!found) return false;
+
+        Entry* old = table->slots[index].load(std::memory_order_relaxed);
+        table->slots[index].store(tombstone(), std::memory_order_release);
+        size_.store(size_.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        EpochDomain::global().retire(old);
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    void ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::clear() {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        Table* old = table_.load(std::memory_order_relaxed);
+        table_.store(new Table(old->capacity), std::memory_order_release);
+        size_.store(0, std::memory_order_relaxed);
+        used_ = 0;
+
+        EpochDomain& domain = EpochDomain::global();
+        for (size_t i = 0; i < old->capacity; ++i) {
+            Entry* entry = old->slots[i].load(std::memory_order_relaxed);
+            if (entry && entry != tombstone()) domain.retire(entry);
+        }
+        domain.retire(old);
+    }
+
+    // Accessors
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    size_t ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    bool ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::isEmpty() const {
+        return size() == 0;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe>
+    size_t ReadMostlyHashMap<K, V, Hash, KeyEqual, Probe>::capacity() const {
+        auto guard = EpochDomain::global().pin();
+        return table_.load(std::memory_order_acquire)->capacity;
+    }
+
+} // namespace dsa
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentHashMap.h"
+
+using namespace dsa;
+
+TEST(ConcurrentHashMap, BasicOperations) {
+    ConcurrentHashMap<std::string, int> map(5);
+    EXPECT_EQ(map.shardCount(), 8u);
+    EXPECT_TRUE(map.isEmpty());
+
+    EXPECT_TRUE(map.insert("a", 1));
+    EXPECT_FALSE(map.insert("a", 2));
+    EXPECT_FALSE(map.insertOrAssign("a", 3));
+    EXPECT_TRUE(map.insertOrAssign("b", 4));
+
+    int value = 0;
+    ASSERT_TRUE(map.find("a", value));
+    EXPECT_EQ(value, 3);
+    EXPECT_FALSE(map.find("c", value));
+    EXPECT_EQ(value, 3); // untouched on a miss
+
+    EXPECT_TRUE(map.update("b", [](int& v) { v *= 10; }));
+    EXPECT_FALSE(map.update("c", [](int&) { FAIL(); }));
+    ASSERT_TRUE(map.find("b", value));
+    EXPECT_EQ(value, 40);
+
+    EXPECT_TRUE(map.remove("a"));
+    EXPECT_FALSE(map.contains("a"));
+    EXPECT_EQ(map.size(), 1u);
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+}
+
+TEST(ConcurrentHashMap, ParallelWritersAndReaders) {
+    ConcurrentHashMap<int, int> map(16, 16, 0.5f, true);
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 5000;
+    std::atomic<bool> writing{true};
+    std::atomic<long> readHits{0};
+    std::atomic<int> readersReady{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&] {
+            int value;
+            readersReady.fetch_add(1);
+            while (writing.load()) {
+                for (int k = 0; k < 1000; ++k) {
+                    // Any value seen must be the one written for that key.
+                    if (map.find(k, value)) {
+                        ASSERT_EQ(value, k * 2);
+                        readHits.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+    // Start the writers only once the readers are running alongside them.
+    while (readersReady.load() < 2) std::this_thread::yield();
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < kThreads; ++t) {
+        writers.emplace_back([&, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                int key = t * kPerThread + i;
+                ASSERT_TRUE(map.insert(key, key * 2));
+                if (i % 4 == 0) {
+                    ASSERT_TRUE(map.remove(key));
+                }
+            }
+        });
+    }
+    for (auto& w : writers) w.join();
+    writing = false;
+    for (auto& r : readers) r.join();
+
+    EXPECT_GT(readHits.load(), 0);
+    EXPECT_EQ(map.size(), static_cast<size_t>(kThreads * kPerThread * 3 / 4));
+    for (int key = 0; key < kThreads * kPerThread; ++key) {
+        EXPECT_EQ(map.contains(key), key % kPerThread % 4 != 0) << key;
+    }
+}
+
+TEST(ConcurrentHashMap, UpdateIsAtomicPerKey) {
+    ConcurrentHashMap<int, long> map;
+    for (int k = 0; k < 16; ++k) map.insert(k, 0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 10000; ++i) map.update(i % 16, [](long& v) { ++v; });
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    long total = 0, value = 0;
+    for (int k = 0; k < 16; ++k) {
+        ASSERT_TRUE(map.find(k, value));
+        total += value;
+    }
+    EXPECT_EQ(total, 8 * 10000);
+}
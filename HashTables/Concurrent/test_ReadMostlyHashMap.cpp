@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ReadMostlyHashMap.h"
+
+using namespace dsa;
+
+namespace {
+    // Counts live instances, to check that retired entries are eventually freed.
+    struct Tracked {
+        static inline std::atomic<int> live{0};
+        int value = 0;
+
+        Tracked() { ++live; }
+        Tracked(int v) : value(v) { ++live; }
+        Tracked(const Tracked& other) : value(other.value) { ++live; }
+        Tracked& operator=(const Tracked&) = default;
+        ~Tracked() { --live; }
+    };
+}
+
+TEST(EpochDomain, RetiredObjectOutlivesPinnedReader) {
+    EpochDomain& domain = EpochDomain::global();
+    domain.reclaim();
+    int before = Tracked::live;
+
+    std::atomic<bool> pinned{false}, release{false};
+    std::thread reader([&] {
+        auto guard = domain.pin();
+        auto nested = domain.pin();
+        pinned = true;
+        while (!release) std::this_thread::yield();
+    });
+    while (!pinned) std::this_thread::yield();
+
+    domain.retire(new Tracked(1));
+    domain.reclaim();
+    EXPECT_EQ(Tracked::live, before + 1);
+
+    release = true;
+    reader.join();
+    domain.reclaim();
+    EXPECT_EQ(Tracked::live, before);
+}
+
+TEST(ReadMostlyHashMap, BasicOperations) {
+    ReadMostlyHashMap<std::string, int> map(4);
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_TRUE(map.insert("a", 1));
+    EXPECT_FALSE(map.insert("a", 2));
+    EXPECT_FALSE(map.insertOrAssign("a", 3));
+    EXPECT_TRUE(map.insertOrAssign("b", 4));
+
+    int value = 0;
+    ASSERT_TRUE(map.find("a", value));
+    EXPECT_EQ(value, 3);
+    EXPECT_FALSE(map.find("c", value));
+    EXPECT_EQ(value, 3);
+
+    EXPECT_TRUE(map.remove("a"));
+    EXPECT_FALSE(map.remove("a"));
+    EXPECT_FALSE(map.contains("a"));
+    EXPECT_TRUE(map.contains("b"));
+    EXPECT_EQ(map.size(), 1u);
+
+    for (int i = 0; i < 100; ++i) map.insert(std::to_string(i), i);
+    EXPECT_EQ(map.size(), 101u);
+    EXPECT_GE(map.capacity(), 202u);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(map.find(std::to_string(i), value));
+        EXPECT_EQ(value, i);
+    }
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains("b"));
+}
+
+TEST(ReadMostlyHashMap, ChurnReusesTombstonesWithoutGrowing) {
+    ReadMostlyHashMap<int, int> map(64);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(map.insert(i, i));
+        if (i >= 10) {
+            ASSERT_TRUE(map.remove(i - 10));
+        }
+    }
+    EXPECT_EQ(map.size(), 10u);
+    EXPECT_EQ(map.capacity(), 64u);
+}
+
+TEST(ReadMostlyHashMap, FullLoadFactorGrowsWhenEveryBucketIsLive) {
+    // At load factor 1.0 every bucket may fill; the next new key must grow
+    // the table rather than index one past the last bucket.
+    ReadMostlyHashMap<int, int> map(4, 1.0f);
+    for (int i = 0; i < 20; ++i) ASSERT_TRUE(map.insert(i, i * 3));
+    EXPECT_EQ(map.size(), 20u);
+    EXPECT_GE(map.capacity(), 20u);
+    for (int i = 0; i < 20; ++i) {
+        int out = -1;
+        ASSERT_TRUE(map.find(i, out)) << i;
+        EXPECT_EQ(out, i * 3);
+    }
+    EXPECT_FALSE(map.contains(20));
+
+    for (int i = 0; i < 20; i += 2) ASSERT_TRUE(map.remove(i));
+    for (int i = 20; i < 40; ++i) ASSERT_TRUE(map.insert(i, i * 3));
+    EXPECT_EQ(map.size(), 30u);
+}
+
+TEST(ReadMostlyHashMap, ReadersSeeConsistentValuesDuringWrites) {
+    ReadMostlyHashMap<int, Tracked> map;
+    constexpr int kKeys = 512;
+    for (int k = 0; k < kKeys / 2; ++k) map.insert(k, Tracked(k));
+
+    std::atomic<bool> writing{true};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            Tracked out;
+            while (writing) {
+                for (int k = 0; k < kKeys; ++k) {
+                    // Values are always key + a multiple of kKeys.
+                    if (map.find(k, out)) {
+                        ASSERT_EQ(out.value % kKeys, k);
+                    }
+                }
+            }
+        });
+    }
+
+    // Grows the table, reassigns and removes while the readers run.
+    for (int round = 0; round < 20; ++round) {
+        for (int k = 0; k < kKeys; ++k) map.insertOrAssign(k, Tracked(k + round * kKeys));
+        for (int k = round % 2; k < kKeys; k += 2) map.remove(k);
+    }
+    writing = false;
+    for (auto& r : readers) r.join();
+
+    // Keys removed in the last round are those with the last round's parity.
+    for (int k = 0; k < kKeys; ++k) EXPECT_EQ(map.contains(k), k % 2 == 0) << k;
+}
+
+TEST(ReadMostlyHashMap, EntriesAreFreed) {
+    EpochDomain::global().reclaim();
+    int before = Tracked::live;
+    {
+        ReadMostlyHashMap<int, Tracked> map;
+        for (int i = 0; i < 1000; ++i) map.insert(i, Tracked(i));
+        for (int i = 0; i < 1000; i += 3) map.insertOrAssign(i, Tracked(-i));
+        for (int i = 0; i < 1000; i += 5) map.remove(i);
+        map.clear();
+        for (int i = 0; i < 10; ++i) map.insert(i, Tracked(i));
+    }
+    EpochDomain::global().reclaim();
+    EXPECT_EQ(Tracked::live, before);
+}
@@ -1,7 +1,149 @@
 #pragma once
+#include <concepts>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace dsa {
+    /**
+     * Hashing primitives shared by the Hash specializations below.
+     *
+     * Tables reduce hashes with `% capacity` or a power-of-two mask, which only
+     * looks at the low bits, so every hash here is finalized to make each output
+     * bit depend on every input bit.
+     */
+    namespace hashing {
+        inline constexpr uint64_t kSecret0 = 0xa0761d6478bd642full;
+        inline constexpr uint64_t kSecret1 = 0xe7037ed1a0b428dbull;
+        inline constexpr uint64_t kSecret2 = 0x8ebc6af09c88c6e3ull;
+        inline constexpr uint64_t kSecret3 = 0x589965cc75374cc3ull;
+
+        /**
+         * @brief A bijective 64-bit finalizer (xorshift-multiply, three rounds).
+         * Consecutive or strided integers come out uniformly spread.
+         */
+        constexpr uint64_t mix64(uint64_t x) {
+            x ^= x >> 32;
+            x *= 0xd6e8feb86659fd93ull;
+            x ^= x >> 32;
+            x *= 0xd6e8feb86659fd93ull;
+            x ^= x >> 32;
+            return x;
+        }
+
+        /// @brief Full 64x64 -> 128-bit multiply, returned as (lo, hi).
+        inline void multiply128(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+            __uint128_t r = static_cast<__uint128_t>(a) * b;
+            lo = static_cast<uint64_t>(r);
+            hi = static_cast<uint64_t>(r >> 64);
+#else
+            uint64_t aLo = a & 0xffffffffull, aHi = a >> 32;
+            uint64_t bLo = b & 0xffffffffull, bHi = b >> 32;
+            uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+            uint64_t mid = (ll >> 32) + (lh & 0xffffffffull) + (hl & 0xffffffffull);
+            lo = (mid << 32) | (ll & 0xffffffffull);
+            hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+        }
+
+        /// @brief Multiplies and folds the 128-bit product: the wyhash mixing step.
+        inline uint64_t foldedMultiply(uint64_t a, uint64_t b) {
+            uint64_t lo, hi;
+            multiply128(a, b, lo, hi);
+            return lo ^ hi;
+        }
+
+        inline uint64_t read64(const unsigned char* p) {
+            uint64_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        inline uint64_t read32(const unsigned char* p) {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        /**
+         * @brief Hashes a byte range eight bytes at a time (wyhash-style).
+         *
+         * Inputs up to 16 bytes are read with at most four overlapping loads and
+         * no loop; longer inputs run three independent 16-byte lanes per 48-byte
+         * block so the multiplies can overlap.
+         *
+         * @param data The bytes to hash.
+         * @param len The number of bytes.
+         * @param seed Perturbs the result; equal seeds give equal hashes.
+         */
+        inline uint64_t hashBytes(const void* data, size_t len, uint64_t seed = 0) {
+            const unsigned char* p = static_cast<const unsigned char*>(data);
+            seed ^= foldedMultiply(seed ^ kSecret0, kSecret1);
+
+            uint64_t a, b;
+            if (len <= 16) {
+                if (len >= 4) {
+                    size_t shift = (len >> 3) << 2; // 0 for 4..7 bytes, 4 for 8..16
+                    a = (read32(p) << 32) | read32(p + shift);
+                    b = (read32(p + len - 4) << 32) | read32(p + len - 4 - shift);
+                } else if (len > 0) {
+                    a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) | p[len - 1];
+                    b = 0;
+                } else {
+                    a = b = 0;
+                }
+            } else {
+                size_t remaining = len;
+                if (remaining > 48) {
+                    uint64_t lane1 = seed, lane2 = seed;
+                    do {
+                        seed  = foldedMultiply(read64(p)      ^ kSecret1, read64(p + 8)  ^ seed);
+                        lane1 = foldedMultiply(read64(p + 16) ^ kSecret2, read64(p + 24) ^ lane1);
+                        lane2 = foldedMultiply(read64(p + 32) ^ kSecret3, read64(p + 40) ^ lane2);
+                        p += 48;
+                        remaining -= 48;
+                    } while (remaining > 48);
+                    seed ^= lane1 ^ lane2;
+                }
+                while (remaining > 16) {
+                    seed = foldedMultiply(read64(p) ^ kSecret1, read64(p + 8) ^ seed);
+                    p += 16;
+                    remaining -= 16;
+                }
+                // The last 16 bytes, overlapping already-consumed input if needed.
+                a = read64(p + remaining - 16);
+                b = read64(p + remaining - 8);
+            }
+
+            uint64_t lo, hi;
+            multiply128(a ^ kSecret1, b ^ seed, lo, hi);
+            return foldedMultiply(lo ^ kSecret0 ^ len, hi ^ kSecret1);
+        }
+
+        /// @brief Folds another hash into a running seed; order-sensitive.
+        constexpr uint64_t combine(uint64_t seed, uint64_t value) {
+            return mix64(seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)));
+        }
+    } // namespace hashing
+
+    /**
+     * @brief Holds when both functors declare `is_transparent`, as with
+     * Hash<std::string> and std::equal_to<>. Tables then accept lookup keys
+     * of other types (e.g. std::string_view or const char*) without building
+     * a temporary K. The functors must hash and compare such keys exactly as
+     * they would the equivalent K.
+     */
+    template<typename HashFn, typename KeyEqual>
+    concept TransparentLookup = requires {
+        typename HashFn::is_transparent;
+        typename KeyEqual::is_transparent;
+    };
+
     /**
      * @brief A basic hash functor.
      *
@@ -22,30 +164,77 @@ namespace dsa {
     };
 
     /**
-     * @brief Hash functor specialization for integers.
+     * @brief Hash functor specialization for every integer width, char and bool,
+     * and for enums (hashed through their underlying type).
+     */
+    template<typename K>
+        requires std::integral<K> || std::is_enum_v<K>
+    struct Hash<K> {
+        size_t operator()(K key) const {
+            if constexpr (std::is_enum_v<K>) {
+                using U = std::underlying_type_t<K>;
+                return Hash<U>{}(static_cast<U>(key));
+            } else {
+                // Sign-extend first so that -1 hashes the same at every width.
+                using Wide = std::conditional_t<std::is_signed_v<K>, int64_t, uint64_t>;
+                return static_cast<size_t>(hashing::mix64(static_cast<uint64_t>(static_cast<Wide>(key))));
+            }
+        }
+    };
+
+    /**
+     * @brief Hash functor specialization for pointers. Hashes the address, not the pointee.
+     */
+    template<typename T>
+    struct Hash<T*> {
+        size_t operator()(T* key) const {
+            return static_cast<size_t>(hashing::mix64(reinterpret_cast<uintptr_t>(key)));
+        }
+    };
+
+    /**
+     * @brief Hash functor specialization for std::string_view. Transparent:
+     * std::string and const char* hash identically without conversion.
      */
     template<>
-    struct Hash<int> {
-        size_t operator()(int key) const {
-            // A simple identity hash for integer types.
-            return static_cast<size_t>(key);
+    struct Hash<std::string_view> {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view key) const {
+            return static_cast<size_t>(hashing::hashBytes(key.data(), key.size()));
         }
     };
 
     /**
-     * @brief Hash functor specialization for std::string.
+     * @brief Hash functor specialization for std::string. Agrees with Hash<std::string_view>
+     * and, like it, is transparent, so std::string_view and const char* lookups never allocate.
      */
     template<>
-    struct Hash<std::string> {
-        size_t operator()(const std::string& key) const {
-            // A classic polynomial rolling hash function (djb2-like).
-            size_t hash = 0;
-            for (char c : key)
-                // Use 31, a common prime number, for string hashing.
-                hash = hash * 31 + static_cast<unsigned char>(c);
-            return hash;
+    struct Hash<std::string> : Hash<std::string_view> {};
+
+    /**
+     * @brief Hash functor specialization for std::pair. Order-sensitive.
+     */
+    template<typename A, typename B>
+    struct Hash<std::pair<A, B>> {
+        size_t operator()(const std::pair<A, B>& key) const {
+            uint64_t seed = hashing::combine(0, Hash<A>{}(key.first));
+            return static_cast<size_t>(hashing::combine(seed, Hash<B>{}(key.second)));
         }
     };
 
+    /**
+     * @brief Hash functor specialization for std::tuple. Order-sensitive.
+     */
+    template<typename... Ts>
+    struct Hash<std::tuple<Ts...>> {
+        size_t operator()(const std::tuple<Ts...>& key) const {
+            return std::apply([](const Ts&... elements) {
+                uint64_t seed = sizeof...(Ts);
+                ((seed = hashing::combine(seed, Hash<Ts>{}(elements))), ...);
+                return static_cast<size_t>(seed);
+            }, key);
+        }
+    };
 
-} // namespace dsa
\ No newline at end of file
+} // namespace dsa
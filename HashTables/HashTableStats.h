@@ -0,0 +1,95 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Build with DSA_HASH_TABLE_STATS=1 (the CMake option of the same name) to have
+ * the tables count and time their rehashes. It is off by default, and the
+ * counters then compile away entirely; the rest of stats() is computed on
+ * demand from the table itself and costs nothing until called.
+ */
+#ifndef DSA_HASH_TABLE_STATS
+#define DSA_HASH_TABLE_STATS 0
+#endif
+
+namespace dsa {
+    /**
+     * @brief A snapshot of a hash table's shape, returned by the tables' stats().
+     *
+     * The probe length of an entry is the number of buckets (open addressing)
+     * or nodes (chaining) a successful lookup of it inspects, so 1 means it
+     * sits at its home position. Long tails in the histogram with few
+     * tombstones point at a poor Hash<K>; many tombstones point at churn.
+     */
+    struct HashTableStats {
+        size_t size = 0;                    ///< live entries
+        size_t capacity = 0;                ///< buckets in the current array
+        float  loadFactor = 0.0f;           ///< size / capacity
+        size_t tombstones = 0;              ///< always 0 for chaining
+        size_t maxProbeLength = 0;
+        double meanProbeLength = 0.0;
+        std::vector<size_t> probeHistogram; ///< [i]: entries with probe length i + 1
+        size_t rehashCount = 0;             ///< resizes and compactions; needs DSA_HASH_TABLE_STATS
+        std::chrono::nanoseconds rehashTime{0}; ///< including incremental migration steps
+
+        /// @brief Adds an entry with the given probe length (>= 1).
+        void recordProbe(size_t length) {
+            if (probeHistogram.size() < length) probeHistogram.resize(length, 0);
+            ++probeHistogram[length - 1];
+            maxProbeLength = std::max(maxProbeLength, length);
+        }
+
+        /// @brief Derives the mean probe length from the histogram.
+        void finishProbes() {
+            size_t entries = 0, total = 0;
+            for (size_t i = 0; i < probeHistogram.size(); ++i) {
+                entries += probeHistogram[i];
+                total += probeHistogram[i] * (i + 1);
+            }
+            meanProbeLength = entries ? static_cast<double>(total) / entries : 0.0;
+        }
+    };
+
+    /**
+     * @brief Rehash counters kept inside a table. An empty struct unless
+     * DSA_HASH_TABLE_STATS is on, so with [[no_unique_address]] it takes no space.
+     */
+    struct RehashCounters {
+#if DSA_HASH_TABLE_STATS
+        size_t                   count = 0;
+        std::chrono::nanoseconds time{0};
+#endif
+
+        /// @brief Adds its own lifetime to the counters, and one rehash if asked.
+        class Scope {
+        public:
+#if DSA_HASH_TABLE_STATS
+            Scope(RehashCounters& counters, bool countsRehash)
+                : counters_(counters), start_(std::chrono::steady_clock::now()) {
+                if (countsRehash) ++counters_.count;
+            }
+            ~Scope() { counters_.time += std::chrono::steady_clock::now() - start_; }
+
+        private:
+            RehashCounters&                       counters_;
+            std::chrono::steady_clock::time_point start_;
+#else
+            Scope(RehashCounters&, bool) {}
+#endif
+        public:
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+
+        /// @brief Copies the counters into stats; leaves them 0 when disabled.
+        void report([[maybe_unused]] HashTableStats& stats) const {
+#if DSA_HASH_TABLE_STATS
+            stats.rehashCount = count;
+            stats.rehashTime = time;
+#endif
+        }
+    };
+
+} // namespace dsa
@@ -0,0 +1,151 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "../Prefetch.h"
+
+namespace dsa {
+    /**
+     * Bucket layouts for HashTableOpenAddressingBase.
+     *
+     * A layout exposes a nested `Storage<K, V>`: a fixed number of buckets
+     * addressed by index, each Empty, Occupied or a Tombstone. The table only
+     * touches buckets through it:
+     *   - state(i), key(i), value(i) read a bucket,
+     *   - mayMatch(i, hash) is a cheap test that must hold before key(i) is
+     *     compared, and implies the bucket is occupied,
+     *   - occupy(i, hash) and setState(i, s) change a bucket's state,
+     *   - reset() empties every bucket and prefetch(i) starts loading what a
+     *     probe of bucket i reads first.
+     */
+
+    /// @brief The state of an open addressing bucket.
+    enum class BucketState : uint8_t { Empty, Occupied, Tombstone };
+
+    /**
+     * @brief One array of { key, value, state } buckets (the default).
+     *
+     * A probe loads each bucket whole, value included, and compares the key of
+     * every occupied bucket it passes. Best when V is small.
+     */
+    struct InlineBuckets {
+        template<typename K, typename V>
+        class Storage {
+        public:
+            Storage() = default;
+            explicit Storage(size_t n) : buckets_(n) {}
+
+            size_t size() const { return buckets_.size(); }
+            bool empty() const { return buckets_.empty(); }
+
+            BucketState state(size_t i) const { return buckets_[i].state; }
+            bool mayMatch(size_t i, size_t /*hash*/) const { return buckets_[i].state == BucketState::Occupied; }
+
+            K& key(size_t i) { return buckets_[i].key; }
+            const K& key(size_t i) const { return buckets_[i].key; }
+            V& value(size_t i) { return buckets_[i].value; }
+            const V& value(size_t i) const { return buckets_[i].value; }
+
+            void occupy(size_t i, size_t /*hash*/) { buckets_[i].state = BucketState::Occupied; }
+            void setState(size_t i, BucketState s) { buckets_[i].state = s; }
+
+            void reset() {
+                for (auto& bucket : buckets_) bucket.state = BucketState::Empty;
+            }
+
+            void prefetch(size_t i) const { prefetchRead(&buckets_[i]); }
+
+        private:
+            /// @brief An empty V (as in HashSet) takes no space.
+            struct Bucket {
+                K           key;
+                [[no_unique_address]] V value;
+                BucketState state = BucketState::Empty;
+            };
+
+            // [[no_unique_address]] may be ignored (MSVC wants msvc::no_unique_address),
+            // so check that a set's bucket really is just a key and a state.
+            struct KeyOnlyBucket {
+                K           key;
+                BucketState state;
+            };
+            static_assert(!std::is_empty_v<V> || sizeof(Bucket) == sizeof(KeyOnlyBucket),
+                          "an empty value type must not take space in a bucket");
+
+            std::vector<Bucket> buckets_;
+        };
+    };
+
+    /**
+     * @brief Separate metadata, key and value arrays.
+     *
+     * Each bucket has one metadata byte: Empty, Tombstone, or, when occupied,
+     * the top 7 bits of the key's hash. A probe reads the metadata and compares
+     * a key only when those bits match, so it rarely touches the key array and
+     * never the value array; the value is loaded once, on a hit. No padding is
+     * spent on a state next to each key. Best when V is large, or when keys are
+     * expensive to compare. An empty V gets no array at all.
+     */
+    struct SplitBuckets {
+        template<typename K, typename V>
+        class Storage {
+        public:
+            Storage() = default;
+            explicit Storage(size_t n) : meta_(n, kEmpty), keys_(n) {
+                if constexpr (!kEmptyValue) values_.resize(n);
+            }
+
+            size_t size() const { return meta_.size(); }
+            bool empty() const { return meta_.empty(); }
+
+            BucketState state(size_t i) const {
+                if (meta_[i] == kEmpty) return BucketState::Empty;
+                if (meta_[i] == kTombstone) return BucketState::Tombstone;
+                return BucketState::Occupied;
+            }
+            bool mayMatch(size_t i, size_t hash) const { return meta_[i] == fragment(hash); }
+
+            K& key(size_t i) { return keys_[i]; }
+            const K& key(size_t i) const { return keys_[i]; }
+            V& value(size_t i) {
+                if constexpr (kEmptyValue) return emptyValue_;
+                else return values_[i];
+            }
+            const V& value(size_t i) const {
+                if constexpr (kEmptyValue) return emptyValue_;
+                else return values_[i];
+            }
+
+            void occupy(size_t i, size_t hash) { meta_[i] = fragment(hash); }
+            void setState(size_t i, BucketState s) {
+                // Occupied needs the hash; use occupy() for it.
+                meta_[i] = s == BucketState::Empty ? kEmpty : kTombstone;
+            }
+
+            void reset() { std::fill(meta_.begin(), meta_.end(), kEmpty); }
+
+            void prefetch(size_t i) const {
+                prefetchRead(&meta_[i]);
+                prefetchRead(&keys_[i]);
+            }
+
+        private:
+            static constexpr uint8_t kEmpty     = 0x80;
+            static constexpr uint8_t kTombstone = 0xFE;
+            static constexpr bool    kEmptyValue = std::is_empty_v<V>;
+
+            /// @brief The top 7 bits of the hash; the low bits pick the home bucket.
+            static uint8_t fragment(size_t hash) {
+                return static_cast<uint8_t>(hash >> (sizeof(size_t) * 8 - 7));
+            }
+
+            std::vector<uint8_t> meta_;
+            std::vector<K>       keys_;
+            std::vector<V>       values_;       // unused when V is empty
+            [[no_unique_address]] V emptyValue_{};
+        };
+    };
+
+} // namespace dsa
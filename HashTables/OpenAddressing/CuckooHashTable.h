@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include "../CapacityPolicies.h"
+#include "../Hash.h"
+
+namespace dsa {
+    /**
+     * @brief Bucketized cuckoo hash table: two candidate buckets of four slots each.
+     *
+     * Every key may live in only two buckets, so a lookup inspects at most
+     * eight slots in two buckets (two cache lines for small entries), whatever
+     * the load, and prefetches the second while scanning the first. Each slot keeps
+     * an 8-bit tag from the key's hash, and keys are only compared where the
+     * tag matches.
+     *
+     * The primary bucket comes from the hash; the alternate is the primary
+     * XORed with a hash of the tag (partial-key cuckoo hashing), so an entry's
+     * other bucket is known from its tag alone and displacing it never rehashes
+     * its key. When both buckets of a new key are full, a breadth-first search
+     * over displacement chains finds the shortest path to a free slot, and the
+     * entries along it are shifted into their alternate buckets. If no path
+     * within kMaxSearch buckets exists the table doubles.
+     *
+     * Keys with equal full hashes map to the same two buckets with the same
+     * tag at every size. Once 2 * kSlots of them fill those buckets, the
+     * displacement search for another comes up empty however large the table
+     * is, so insert() doubles at most kMaxGrowAttempts times for one key and
+     * then throws std::length_error. Earlier entries survive the throw.
+     *
+     * Four-way buckets reach load factors above 95% before displacement paths
+     * become hard to find, so the default maximum load is 0.95.
+     *
+     * @tparam K The key type.
+     * @tparam V The value type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     */
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>
+    >
+    class CuckooHashTable {
+    protected:
+        static constexpr size_t kSlots = 4;
+
+        /// @brief Buckets visited by one displacement search before growing instead.
+        static constexpr size_t kMaxSearch = 512;
+
+        /// @brief Doublings one insert may trigger before the hash is deemed too weak.
+        static constexpr size_t kMaxGrowAttempts = 3;
+
+        /**
+         * @brief A bucket of kSlots entries. Tags lead so a lookup reads them
+         * first; a tag of 0 marks an empty slot.
+         */
+        struct Bucket {
+            uint8_t tags[kSlots] = {};
+            K       keys[kSlots];
+            V       values[kSlots];
+        };
+
+        /// @brief A node of the displacement search: the entry in `slot` of the
+        /// parent step's bucket would move into `bucket`.
+        struct SearchStep {
+            size_t  bucket;
+            int32_t parent;   ///< index in search_, or -1 for a key's own bucket
+            uint8_t slot;
+        };
+
+        std::vector<Bucket> buckets_;            ///< bucket array; size is a power of two
+        std::vector<SearchStep> search_;         ///< scratch queue for displacement searches
+        size_t              elementCount_ = 0;   ///< number of live entries
+        float               maxLoadFactor_;      ///< when to trigger rehash
+        Hash                hasher_;             ///< primary hash function
+        KeyEqual            keyEqual_;           ///< key equality check
+
+    public:
+        /**
+         * @brief Constructs the hash table.
+         * @param capacity Initial number of slots; rounded up to a power-of-two
+         *        number of buckets, at least two.
+         * @param maxLoadFactor The load factor at which to trigger a rehash.
+         */
+        explicit
+        CuckooHashTable(size_t capacity = 16,
+                        float  maxLoadFactor = 0.95f);
+
+        /**
+         * @brief Inserts a key/value pair. Returns false if key already exists.
+         * @throws std::length_error if the key cannot be placed even after
+         *         kMaxGrowAttempts doublings (more than 2 * kSlots keys with one hash).
+         */
+        bool insert(const K& key, const V& value);
+
+        /// @brief Removes a key.
+        /// @return false if key is not found.
+        bool remove(const K& key);
+
+        /// @brief Finds a key and returns a pointer to its value. Worst case O(1).
+        /// @return Pointer to the value, or nullptr if not found.
+        V* find(const K& key);
+        const V* find(const K& key) const;
+
+        /// @brief Returns the number of elements in the table.
+        size_t size() const;
+
+        /// @brief Returns the number of slots.
+        size_t capacity() const;
+
+        /// @brief Returns size() / capacity().
+        float loadFactor() const;
+
+        /// @brief Clears the hash table, keeping its capacity.
+        void clear();
+
+    protected:
+        /// @brief A key's primary bucket and tag.
+        struct Position {
+            size_t  bucket;
+            uint8_t tag;
+        };
+
+        /// @brief Mixes the key's hash into its primary bucket and non-zero tag.
+        Position position(const K& key) const;
+
+        /// @brief The other bucket an entry with this tag may occupy.
+        size_t alternate(size_t bucket, uint8_t tag) const;
+
+        /// @brief Returns the slot holding key in bucket b, or kSlots if absent.
+        size_t slotOf(size_t b, const K& key, uint8_t tag) const;
+
+        /// @brief Returns a free slot of bucket b, or kSlots if it is full.
+        size_t freeSlot(size_t b) const;
+
+        /**
+         * @brief Places an entry known to be absent, displacing others if needed.
+         * @return false if no displacement path was found; nothing changed.
+         */
+        bool place(K&& key, V&& value, Position pos);
+
+        /// @brief Moves all entries into a table with at least newBucketCount buckets.
+        void rehash(size_t newBucketCount);
+    };
+} // namespace dsa
+
+#include "CuckooHashTable.tpp"
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <utility>
+#include "../Prefetch.h"
+
+namespace dsa {
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    CuckooHashTable<K, V, Hash, KeyEqual>::CuckooHashTable(
+        size_t capacity,
+        float maxLoadFactor
+    )
+        : buckets_(PowerOfTwoMask::normalize(std::max<size_t>((capacity + kSlots - 1) / kSlots, 2))),
+          elementCount_(0),
+          maxLoadFactor_(maxLoadFactor),
+          hasher_(),
+          keyEqual_()
+    {
+        search_.reserve(kMaxSearch);
+    }
+
+    // Hashing
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    typename CuckooHashTable<K, V, Hash, KeyEqual>::Position
+    CuckooHashTable<K, V, Hash, KeyEqual>::position(const K& key) const {
+        // Hash<K> already mixes: the low bits pick the bucket, the top byte the tag.
+        uint64_t h = static_cast<uint64_t>(hasher_(key));
+        uint8_t tag = static_cast<uint8_t>(h >> 56);
+        return { PowerOfTwoMask::reduce(static_cast<size_t>(h), buckets_.size()), tag ? tag : uint8_t{1} };
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t CuckooHashTable<K, V, Hash, KeyEqual>::alternate(size_t bucket, uint8_t tag) const {
+        // XOR with an odd value: an involution that never maps a bucket to itself.
+        return (bucket ^ static_cast<size_t>(hashing::mix64(tag) | 1)) & (buckets_.size() - 1);
+    }
+
+    // Slot helpers
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t CuckooHashTable<K, V, Hash, KeyEqual>::slotOf(size_t b, const K& key, uint8_t tag) const {
+        const Bucket& bucket = buckets_[b];
+        for (size_t s = 0; s < kSlots; ++s) {
+            if (bucket.tags[s] == tag && keyEqual_(bucket.keys[s], key)) return s;
+        }
+        return kSlots;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t CuckooHashTable<K, V, Hash, KeyEqual>::freeSlot(size_t b) const {
+        const Bucket& bucket = buckets_[b];
+        for (size_t s = 0; s < kSlots; ++s) {
+            if (bucket.tags[s] == 0) return s;
+        }
+        return kSlots;
+    }
+
+    // Placement
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool CuckooHashTable<K, V, Hash, KeyEqual>::place(K&& key, V&& value, Position pos) {
+        // Breadth-first search from both candidate buckets; the first bucket
+        // with a free slot ends the shortest displacement path.
+        search_.clear();
+        search_.push_back({ pos.bucket, -1, 0 });
+        search_.push_back({ alternate(pos.bucket, pos.tag), -1, 0 });
+
+        for (size_t head = 0; head < search_.size(); ++head) {
+            size_t hole = freeSlot(search_[head].bucket);
+            if (hole != kSlots) {
+                // Walk the path back to the root, moving each entry into the hole
+                // ahead of it; the hole ends up in one of the key's own buckets.
+                size_t step = head;
+                while (search_[step].parent >= 0) {
+                    const SearchStep& to = search_[step];
+                    Bucket& dst = buckets_[to.bucket];
+                    Bucket& src = buckets_[search_[to.parent].bucket];
+
+                    dst.tags[hole] = src.tags[to.slot];
+                    dst.keys[hole] = std::move(src.keys[to.slot]);
+                    dst.values[hole] = std::move(src.values[to.slot]);
+                    hole = to.slot;
+                    step = static_cast<size_t>(to.parent);
+                }
+
+                Bucket& root = buckets_[search_[step].bucket];
+                root.tags[hole] = pos.tag;
+                root.keys[hole] = std::move(key);
+                root.values[hole] = std::move(value);
+                ++elementCount_;
+                return true;
+            }
+
+            // Full: every entry here could move to its alternate bucket.
+            for (uint8_t s = 0; s < kSlots && search_.size() < kMaxSearch; ++s) {
+                size_t next = alternate(search_[head].bucket, buckets_[search_[head].bucket].tags[s]);
+
+                // A path must not pass through the same bucket twice.
+                bool onPath = false;
+                for (int32_t a = static_cast<int32_t>(head); a >= 0 && !onPath; a = search_[a].parent) {
+                    onPath = search_[a].bucket == next;
+                }
+                if (!onPath) search_.push_back({ next, static_cast<int32_t>(head), s });
+            }
+        }
+        return false;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void CuckooHashTable<K, V, Hash, KeyEqual>::rehash(size_t newBucketCount) {
+        std::vector<Bucket> oldBuckets = std::move(buckets_);
+        buckets_ = std::vector<Bucket>(newBucketCount);
+        elementCount_ = 0;
+
+        for (auto& bucket : oldBuckets) {
+            for (size_t s = 0; s < kSlots; ++s) {
+                if (bucket.tags[s] == 0) continue;
+                // A failed place() found no displacement path and moved
+                // nothing, so retry the same entry one doubling later. It fitted
+                // the smaller table, and with at most 2 * kSlots keys per hash
+                // a larger table always has a path.
+                while (!place(std::move(bucket.keys[s]), std::move(bucket.values[s]), position(bucket.keys[s]))) {
+                    rehash(PowerOfTwoMask::grow(buckets_.size()));
+                }
+            }
+        }
+    }
+
+    // Core operations
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool CuckooHashTable<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
+        if (find(key) != nullptr) return false; // Duplicate key
+
+        // Rehash if over load factor
+        if (elementCount_ + 1.0f > maxLoadFactor_ * capacity()) {
+            rehash(PowerOfTwoMask::grow(buckets_.size()));
+        }
+
+        K newKey = key;
+        V newValue = value;
+        for (size_t attempt = 0; !place(std::move(newKey), std::move(newValue), position(key)); ++attempt) {
+            if (attempt == kMaxGrowAttempts) {
+                throw std::length_error("CuckooHashTable::insert: no slot after repeated growth; "
+                                        "too many keys share a hash.");
+            }
+            rehash(PowerOfTwoMask::grow(buckets_.size())); // no displacement path: grow
+        }
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool CuckooHashTable<K, V, Hash, KeyEqual>::remove(const K& key) {
+        Position pos = position(key);
+        size_t b = pos.bucket;
+        size_t s = slotOf(b, key, pos.tag);
+        if (s == kSlots) {
+            b = alternate(pos.bucket, pos.tag);
+            s = slotOf(b, key, pos.tag);
+            if (s == kSlots) return false;
+        }
+
+        buckets_[b].tags[s] = 0; // no tombstone needed: lookups never probe further
+        --elementCount_;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    V* CuckooHashTable<K, V, Hash, KeyEqual>::find(const K& key) {
+        return const_cast<V*>(std::as_const(*this).find(key));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    const V* CuckooHashTable<K, V, Hash, KeyEqual>::find(const K& key) const {
+        Position pos = position(key);
+        size_t alt = alternate(pos.bucket, pos.tag);
+        prefetchRead(&buckets_[alt]); // load both candidate buckets in parallel
+
+        size_t s = slotOf(pos.bucket, key, pos.tag);
+        if (s != kSlots) return &buckets_[pos.bucket].values[s];
+
+        s = slotOf(alt, key, pos.tag);
+        return s == kSlots ? nullptr : &buckets_[alt].values[s];
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t CuckooHashTable<K, V, Hash, KeyEqual>::size() const {
+        return elementCount_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t CuckooHashTable<K, V, Hash, KeyEqual>::capacity() const {
+        return buckets_.size() * kSlots;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    float CuckooHashTable<K, V, Hash, KeyEqual>::loadFactor() const {
+        return static_cast<float>(elementCount_) / capacity();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void CuckooHashTable<K, V, Hash, KeyEqual>::clear() {
+        for (auto& bucket : buckets_) {
+            std::fill(std::begin(bucket.tags), std::end(bucket.tags), uint8_t{0});
+        }
+        elementCount_ = 0;
+    }
+
+} // namespace dsa
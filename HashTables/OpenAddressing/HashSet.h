@@ -0,0 +1,51 @@
+#pragma once
+#include "HashTableOpenAddressingBase.h"
+#include "../SetValue.h"
+
+namespace dsa {
+    /**
+     * @brief An open addressing hash set: HashTableOpenAddressingBase with no values.
+     *
+     * Buckets hold the key and a one-byte state, with no dummy value, so for
+     * small keys a set needs roughly half the memory of a map used as a set.
+     * SplitBuckets also moves the states out of line, removing their padding.
+     * Probing, growth, tombstone handling and stats are the base's.
+     *
+     * @tparam K The key type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     * @tparam Probe The probe policy (LinearProbe, QuadraticProbe, DoubleHashProbe).
+     * @tparam Capacity The capacity policy (PowerOfTwoMask, FibonacciReduce, PrimeCapacity).
+     * @tparam Layout The bucket layout; with SplitBuckets a key costs sizeof(K) + 1 bytes.
+     */
+    template<typename K, typename Hash = Hash<K>, typename KeyEqual = std::equal_to<K>,
+             typename Probe = LinearProbe, typename Capacity = PowerOfTwoMask, typename Layout = InlineBuckets>
+    class HashSet
+      : private HashTableOpenAddressingBase<K, SetValue, Hash, KeyEqual, Probe, Capacity, Layout>
+    {
+    public:
+        using Base = HashTableOpenAddressingBase<K, SetValue, Hash, KeyEqual, Probe, Capacity, Layout>;
+        using Base::Base;  // Inherit constructors
+
+        using Base::remove;
+        using Base::size;
+        using Base::capacity;
+        using Base::clear;
+        using Base::compact;
+        using Base::tombstoneCount;
+        using Base::isRehashing;
+        using Base::stats;
+
+        /// @brief Adds a key. Returns false if it was already present.
+        bool insert(const K& key) { return Base::tryEmplace(key).second; }
+        bool insert(K&& key) { return Base::tryEmplace(std::move(key)).second; }
+
+        /// @brief Checks if the set is empty. O(1).
+        bool isEmpty() const { return Base::size() == 0; }
+
+        /// @brief Checks if a key is present.
+        bool contains(const K& key) const { return Base::find(key) != nullptr; }
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        bool contains(const Q& key) const { return Base::find(key) != nullptr; }
+    };
+} // namespace dsa
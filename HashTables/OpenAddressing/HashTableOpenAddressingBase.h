@@ -1,94 +1,267 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include "../CapacityPolicies.h"
 #include "../Hash.h"
+#include "../HashTableStats.h"
+#include "BucketLayouts.h"
+#include "ProbePolicies.h"
 
 namespace dsa {
     /**
-     * @brief An abstract base class for open addressing hash tables.
+     * @brief The common base for open addressing hash tables.
      *
      * This class handles the common logic for open addressing schemes, including
      * storage, resizing, and managing the state of each bucket (Empty, Occupied,
-     * or Tombstone). The specific collision resolution strategy is deferred to
-     * subclasses through the pure virtual `probeIndex` method.
+     * or Tombstone). The collision resolution strategy is the compile-time
+     * `Probe` policy (see ProbePolicies.h): each operation hashes the key once,
+     * then walks the policy's probe sequence with no virtual calls. The
+     * `Capacity` policy (see CapacityPolicies.h) fixes the allowed table sizes
+     * and how a hash is reduced to its home bucket; the power-of-two policies
+     * do that without a division.
+     *
+     * Growth is either all at once (the default) or incremental. In incremental
+     * mode a resize only allocates the new table; the old one is kept and
+     * insert() / remove() each migrate a bounded number of old buckets, while
+     * lookups consult both tables until the migration finishes. No single
+     * operation then pays for moving the whole table.
+     *
+     * Tombstones count toward the load factor, since probes walk past them like
+     * past live entries. When they push the load over the limit and the live
+     * entries alone would fit comfortably, the table is rebuilt at the same
+     * capacity instead of grown, so constant insert/remove churn cannot fill it
+     * with tombstones. compact() does the same on demand. With linear probing,
+     * remove() also leaves no tombstone where the next bucket is empty, and
+     * clears the run of tombstones before it.
+     *
+     * The `Layout` policy (see BucketLayouts.h) decides how buckets sit in
+     * memory: InlineBuckets keeps { key, value, state } together, SplitBuckets
+     * keeps a metadata byte (state plus 7 hash bits), the keys and the values
+     * in three arrays, so probes read metadata and keys only and load a value
+     * once, on a hit.
+     *
+     * When Hash and KeyEqual are both transparent (see TransparentLookup), for
+     * example Hash<std::string> with std::equal_to<>, find(), remove() and
+     * tryEmplace() accept any key type the functors understand, so looking up
+     * a std::string key by std::string_view builds no temporary string.
      *
      * @tparam K The key type.
      * @tparam V The value type.
      * @tparam Hash The hash function object type.
      * @tparam KeyEqual The key equality comparison object type.
+     * @tparam Probe The probe policy (LinearProbe, QuadraticProbe, DoubleHashProbe).
+     * @tparam Capacity The capacity policy (PowerOfTwoMask, FibonacciReduce, PrimeCapacity).
+     * @tparam Layout The bucket layout (InlineBuckets, SplitBuckets).
      */
     template<
         typename K,
         typename V,
         typename Hash     = Hash<K>,
-        typename KeyEqual = std::equal_to<K>
+        typename KeyEqual = std::equal_to<K>,
+        typename Probe    = LinearProbe,
+        typename Capacity = PowerOfTwoMask,
+        typename Layout   = InlineBuckets
     >
     class HashTableOpenAddressingBase {
     protected:
-        /// @brief Represents the state of a bucket in the hash table.
-        enum class State { Empty, Occupied, Tombstone };
+        using State = BucketState;
 
-        /**
-         * @brief A bucket in the hash table, storing the key, value, and state.
-         */
-        struct Bucket {
-            K     key;
-            V     value;
-            State state = State::Empty;
-        };
+        /// @brief The bucket array, laid out as the Layout policy dictates.
+        using Storage = typename Layout::template Storage<K, V>;
 
-        std::vector<Bucket> table_;              ///< underlying bucket array
-        size_t              elementCount_ = 0;   ///< number of live entries
+        /// @brief Old buckets migrated per insert() or remove() while rehashing.
+        static constexpr size_t kMigrationStep = 16;
+
+        /// @brief Keys hashed and prefetched together by the batch operations.
+        static constexpr size_t kBatchGroup = 16;
+
+        /// @brief Over the load limit, rebuild at the same size (rather than grow)
+        /// while live entries use at most this fraction of it.
+        static constexpr float kCompactBelow = 0.75f;
+
+        Storage             table_;              ///< underlying bucket array
+        Storage             oldTable_;           ///< previous array while migrating, else empty
+        size_t              migrateCursor_ = 0;  ///< old buckets below this have been moved
+        size_t              elementCount_ = 0;   ///< number of live entries, in both arrays
+        size_t              tombstoneCount_ = 0; ///< number of tombstones in table_
         float               maxLoadFactor_;      ///< when to trigger rehash
+        bool                incremental_;        ///< migrate gradually instead of all at once
         Hash                hasher_;             ///< primary hash function
         KeyEqual            keyEqual_;           ///< key equality check
+        [[no_unique_address]] RehashCounters rehashCounters_; ///< empty unless DSA_HASH_TABLE_STATS
 
     public:
         /**
          * @brief Constructs the hash table.
-         * @param capacity Initial number of buckets.
+         * @param capacity Initial number of buckets, rounded up to one the capacity policy allows.
          * @param maxLoadFactor The load factor at which to trigger a rehash.
+         * @param incrementalRehash Spread each resize across later operations.
          */
         explicit
         HashTableOpenAddressingBase(size_t capacity = 16,
-                                    float  maxLoadFactor = 0.5f);
+                                    float  maxLoadFactor = 0.5f,
+                                    bool   incrementalRehash = false);
 
         /// @brief Inserts a key/value pair. Returns false if key already exists.
         bool insert(const K& key, const V& value);
+        bool insert(K&& key, V&& value);
+
+        /**
+         * @brief Constructs a key and value from args (as for a std::pair<K, V>),
+         * then inserts them by move. Both are built even if the key exists;
+         * prefer tryEmplace() when that matters.
+         * @return The value for the key, and whether it was inserted.
+         */
+        template<typename... Args>
+        std::pair<V*, bool> emplace(Args&&... args);
+
+        /**
+         * @brief Inserts a value constructed from args if the key is absent.
+         * Nothing is constructed or moved from when the key exists. A transparent
+         * lookup key is converted to K only when it is inserted.
+         * @return The value for the key, and whether it was inserted. The pointer
+         *         is nullptr only if the table is completely full.
+         */
+        template<typename KeyArg, typename... Args>
+        std::pair<V*, bool> tryEmplace(KeyArg&& key, Args&&... args);
+
+        /**
+         * @brief Inserts the key with `value`, or assigns `value` if the key exists.
+         * @return true if inserted, false if assigned.
+         */
+        template<typename KeyArg, typename M>
+        bool insertOrAssign(KeyArg&& key, M&& value);
 
         /// @brief Removes a key. Uses a tombstone to mark the bucket as deleted.
         /// @return false if key is not found.
         bool remove(const K &key);
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        bool remove(const Q& key);
 
         /// @brief Finds a key and returns a pointer to its value.
         /// @return Pointer to the value, or nullptr if not found.
         V* find(const K& key);
         const V* find(const K& key) const;
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        V* find(const Q& key);
+        template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+        const V* find(const Q& key) const;
+
+        /**
+         * @brief Looks up n keys at once, overlapping their cache misses.
+         *
+         * Keys are handled in groups: each group is hashed and every home bucket
+         * prefetched before any is probed, so for tables larger than the cache
+         * the memory stalls of a group overlap instead of adding up.
+         * @param keys The n keys to find.
+         * @param n The number of keys.
+         * @param outValues Receives n pointers: each key's value, or nullptr if absent.
+         * @return The number of keys found.
+         */
+        size_t findBatch(const K* keys, size_t n, V** outValues);
+
+        /**
+         * @brief Inserts n key/value pairs, prefetching home buckets group by group.
+         * Without incremental rehashing the table is first grown to fit all n.
+         * @return The number of pairs inserted; existing keys are left unchanged.
+         */
+        size_t insertBatch(const K* keys, const V* values, size_t n);
 
         /// @brief Returns the number of elements in the table.
         size_t size() const;
 
+        /// @brief Returns the current number of buckets.
+        size_t capacity() const;
+
+        /// @brief Returns the number of tombstones left by remove() in the current array.
+        size_t tombstoneCount() const;
+
+        /**
+         * @brief Rebuilds the table at its current capacity, dropping every
+         * tombstone so probes stop at the first empty bucket again. O(capacity).
+         */
+        void compact();
+
         /// @brief Clears the hash table, resetting it to its initial state.
         void clear();
 
+        /// @brief Checks if an incremental migration is in progress.
+        bool isRehashing() const;
+
+        /**
+         * @brief Reports load, tombstones and the probe-length distribution
+         * (see HashTableStats). Entries still in the old array during a
+         * migration count their probes within that array. O(capacity x probe length).
+         */
+        HashTableStats stats() const;
+
     protected:
+        using ProbeSequence = typename Probe::Sequence;
+
+        /// @brief Starts the probe sequence for `hash` in a table of `capacity` buckets.
+        static ProbeSequence probe(size_t hash, size_t capacity);
+
+        /// @brief True if a Q can be looked up as is, without first converting it to K.
+        template<typename Q>
+        static constexpr bool isLookupKey =
+            std::is_same_v<std::remove_cvref_t<Q>, K> || TransparentLookup<Hash, KeyEqual>;
+
+        /// @brief Returns the index of key in `table`, or table.size() if absent.
+        template<typename Q>
+        size_t findIndexIn(const Storage& table, const Q& key, size_t hash) const;
+
+        /// @brief Returns the value of key (with the given hash) in either array, or nullptr.
+        template<typename Q>
+        const V* locate(const Q& key, size_t hash) const;
+
+        /// @brief Prefetches the home bucket of `hash` in both arrays.
+        void prefetchHome(size_t hash) const;
+
+        /// @brief tryEmplace() for a lookup-ready key whose hash is known.
+        template<typename KeyArg, typename... Args>
+        std::pair<V*, bool> tryEmplaceHashed(size_t hash, KeyArg&& key, Args&&... args);
+
+        /// @brief A bucket found by prepareInsert().
+        struct InsertPosition {
+            Storage* table;   ///< array holding the bucket, or nullptr if none is free
+            size_t   index;
+            bool     fresh;   ///< true if the bucket is free to fill in table_
+        };
+
         /**
-         * @brief (Pure Virtual) The probing function to be implemented by subclasses.
-         *
-         * This function defines the specific open addressing strategy (linear, quadratic, etc.).
-         * @param key The key being probed.
-         * @param attempt The current probe attempt number (0-based).
-         * @return The next bucket index to check.
+         * @brief Finds where key goes, growing and migrating first as needed.
+         * @return The bucket holding key if present, else a free bucket in
+         *         table_; {nullptr, 0, false} if no bucket is free.
          */
-        virtual size_t probeIndex(const K& key, size_t attempt) const = 0;
+        template<typename Q>
+        InsertPosition prepareInsert(const Q& key, size_t hash);
+
+        /// @brief Tombstones the bucket holding key, if any.
+        template<typename Q>
+        bool removeKey(const Q& key);
+
+        /// @brief Frees table_[index]: a tombstone, or Empty where no probe chain passes on.
+        void release(size_t index);
+
+        /// @brief Moves an entry known to be absent into the first free bucket of table_.
+        void placeNew(K&& key, V&& value, size_t hash);
+
+        /// @brief Moves to newCapacity buckets, all at once or by starting a migration.
+        void resize(size_t newCapacity);
+
+        /// @brief Moves up to `count` old buckets into table_.
+        void migrate(size_t count);
 
-        /// @brief Doubles the table capacity and re-inserts all elements.
+        /// @brief Moves all elements into a new array of the given capacity.
         void rehash(size_t newCapacity);
 
-        /// @brief Calculates the next capacity for the table, typically by doubling.
+        /// @brief Calculates the next capacity for the table, as the capacity policy dictates.
         size_t nextCapacity() const;
     };
 } // namespace dsa
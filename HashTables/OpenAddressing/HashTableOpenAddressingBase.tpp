@@ -1,129 +1,437 @@
 #include "HashTableOpenAddressingBase.h"
+#include <algorithm>
+#include <utility>
 
 namespace dsa {
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::HashTableOpenAddressingBase(
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::HashTableOpenAddressingBase(
         size_t capacity,
-        float maxLoadFactor
+        float maxLoadFactor,
+        bool incrementalRehash
     )
-        : table_(capacity),    // vector of default-initialized Buckets
+        : table_(Capacity::normalize(capacity)),    // every bucket starts Empty
           elementCount_(0),
           maxLoadFactor_(maxLoadFactor),
+          incremental_(incrementalRehash),
           hasher_(),
           keyEqual_()
     {}
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::rehash(size_t newCapacity) {
-        std::vector<Bucket> oldTable = std::move(table_);
+    // Probing
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    typename HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::ProbeSequence
+    HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::probe(size_t hash, size_t capacity) {
+        return ProbeSequence(Capacity::reduce(hash, capacity), hash, capacity);
+    }
 
-        table_.clear();
-        table_.resize(newCapacity);
-        elementCount_ = 0;
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::findIndexIn(
+        const Storage& table, const Q& key, size_t hash) const
+    {
+        if (table.empty()) return 0;
+        ProbeSequence seq = probe(hash, table.size());
+        for (size_t attempt = 0; attempt < table.size(); ++attempt, seq.next()) {
+            size_t idx = seq.index();
+
+            if (table.state(idx) == State::Empty) break; // key not found, stop
+            if (table.mayMatch(idx, hash) && keyEqual_(table.key(idx), key)) return idx;
+
+            // else: keep probing (Tombstone or mismatch)
+        }
+        return table.size();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q>
+    const V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::locate(const Q& key, size_t hash) const {
+        size_t idx = findIndexIn(table_, key, hash);
+        if (idx != table_.size()) return &table_.value(idx);
+
+        if (!oldTable_.empty()) {
+            idx = findIndexIn(oldTable_, key, hash);
+            if (idx != oldTable_.size()) return &oldTable_.value(idx);
+        }
+        return nullptr;
+    }
+
+    // Resizing
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::placeNew(K&& key, V&& value, size_t hash) {
+        ProbeSequence seq = probe(hash, table_.size());
+        while (table_.state(seq.index()) == State::Occupied) seq.next();
 
-        for (const auto& bucket : oldTable) {
-            if (bucket.state == State::Occupied) {
-                insert(bucket.key, bucket.value);
+        size_t idx = seq.index();
+        if (table_.state(idx) == State::Tombstone) --tombstoneCount_;
+        table_.key(idx) = std::move(key);
+        table_.value(idx) = std::move(value);
+        table_.occupy(idx, hash);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::rehash(size_t newCapacity) {
+        migrate(oldTable_.size()); // finish any migration first
+        RehashCounters::Scope timing(rehashCounters_, true);
+        Storage oldTable = std::move(table_);
+
+        table_ = Storage(newCapacity);
+        tombstoneCount_ = 0;
+
+        // Keys are already unique: move them straight into free buckets.
+        for (size_t i = 0; i < oldTable.size(); ++i) {
+            if (oldTable.state(i) == State::Occupied) {
+                size_t hash = hasher_(oldTable.key(i));
+                placeNew(std::move(oldTable.key(i)), std::move(oldTable.value(i)), hash);
             }
         }
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
-        // Rehash if over load factor
-        if ((elementCount_ + 1.0f) / table_.size() > maxLoadFactor_) {
-            rehash(nextCapacity());
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::resize(size_t newCapacity) {
+        if (!incremental_) {
+            rehash(newCapacity);
+            return;
+        }
+
+        // A new resize before the last migration finished: finish it now.
+        // With kMigrationStep buckets per operation this only happens at
+        // load factors far below anything useful.
+        migrate(oldTable_.size());
+        RehashCounters::Scope timing(rehashCounters_, true);
+        oldTable_ = std::move(table_);
+        table_ = Storage(newCapacity);
+        tombstoneCount_ = 0;
+        migrateCursor_ = 0;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::migrate(size_t count) {
+        if (oldTable_.empty()) return;
+        RehashCounters::Scope timing(rehashCounters_, false);
+
+        size_t end = std::min(oldTable_.size(), migrateCursor_ + count);
+        for (; migrateCursor_ < end; ++migrateCursor_) {
+            size_t i = migrateCursor_;
+            if (oldTable_.state(i) != State::Occupied) continue;
+
+            size_t hash = hasher_(oldTable_.key(i));
+            placeNew(std::move(oldTable_.key(i)), std::move(oldTable_.value(i)), hash);
+            // A tombstone, not Empty: old probe chains still pass through here.
+            oldTable_.setState(i, State::Tombstone);
+        }
+
+        if (migrateCursor_ == oldTable_.size()) {
+            oldTable_ = Storage(); // release the memory
+            migrateCursor_ = 0;
+        }
+    }
+
+    // Core operations
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q>
+    typename HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::InsertPosition
+    HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::prepareInsert(const Q& key, size_t hash) {
+        // Rehash if over load factor. Tombstones count: probes walk past them too.
+        float budget = maxLoadFactor_ * table_.size();
+        if (elementCount_ + tombstoneCount_ + 1.0f > budget) {
+            // Mostly tombstones: clearing them makes enough room without growing.
+            resize(elementCount_ + 1.0f > kCompactBelow * budget ? nextCapacity() : table_.size());
+        }
+
+        if (!oldTable_.empty()) {
+            migrate(kMigrationStep);
+            if (!oldTable_.empty()) {
+                size_t oldIdx = findIndexIn(oldTable_, key, hash);
+                if (oldIdx != oldTable_.size()) return {&oldTable_, oldIdx, false}; // not migrated yet
+            }
         }
 
         size_t firstTombstone = table_.size(); // no tombstone found yet
 
-        for (size_t attempt = 0; attempt < table_.size(); ++attempt) {
-            size_t idx = probeIndex(key, attempt);
-            auto& bucket = table_[idx];
+        ProbeSequence seq = probe(hash, table_.size());
+        for (size_t attempt = 0; attempt < table_.size(); ++attempt, seq.next()) {
+            size_t idx = seq.index();
+            State state = table_.state(idx);
 
-            if (bucket.state == State::Empty) {
+            if (state == State::Empty) {
                 // If tombstone found earlier, insert there
                 size_t insertIdx = (firstTombstone != table_.size()) ? firstTombstone : idx;
-                table_[insertIdx] = Bucket{ key, value, State::Occupied };
-                ++elementCount_;
-                return true;
+                return {&table_, insertIdx, true};
             }
 
-            if (bucket.state == State::Tombstone) {
+            if (state == State::Tombstone) {
                 if (firstTombstone == table_.size()) {
                     firstTombstone = idx;
                 }
                 continue;
             }
 
-            if (bucket.state == State::Occupied && keyEqual_(bucket.key, key)) {
+            if (table_.mayMatch(idx, hash) && keyEqual_(table_.key(idx), key)) {
                 // Duplicate key
-                return false;
+                return {&table_, idx, false};
             }
         }
-        return false;
+
+        // Probed every bucket without meeting an empty one.
+        if (firstTombstone != table_.size()) return {&table_, firstTombstone, true};
+        return {nullptr, 0, false};
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename KeyArg, typename... Args>
+    std::pair<V*, bool> HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::tryEmplace(KeyArg&& key, Args&&... args) {
+        if constexpr (!isLookupKey<KeyArg>) {
+            // Not transparent: convert once and look up the real key.
+            return tryEmplace(K(std::forward<KeyArg>(key)), std::forward<Args>(args)...);
+        } else {
+            size_t hash = hasher_(key);
+            return tryEmplaceHashed(hash, std::forward<KeyArg>(key), std::forward<Args>(args)...);
+        }
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::remove(const K& key) {
-        for (size_t attempt = 0; attempt < table_.size(); ++attempt) {
-            size_t idx = probeIndex(key, attempt);
-            auto& bucket = table_[idx];
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename KeyArg, typename... Args>
+    std::pair<V*, bool> HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::tryEmplaceHashed(size_t hash, KeyArg&& key, Args&&... args) {
+        auto [table, idx, fresh] = prepareInsert(key, hash);
+        if (!fresh) return {table ? &table->value(idx) : nullptr, false};
 
-            if (bucket.state == State::Empty) return false; // key not found, stop
-            if (bucket.state == State::Occupied && keyEqual_(bucket.key, key)) {
-                bucket.state = State::Tombstone;
+        // Mark the bucket occupied last, so a throwing constructor leaves it free.
+        bool reusesTombstone = table_.state(idx) == State::Tombstone;
+        if constexpr (std::is_same_v<std::remove_cvref_t<KeyArg>, K>) table_.key(idx) = std::forward<KeyArg>(key);
+        else table_.key(idx) = K(std::forward<KeyArg>(key));
+        table_.value(idx) = V(std::forward<Args>(args)...);
+        table_.occupy(idx, hash);
+        if (reusesTombstone) --tombstoneCount_;
+        ++elementCount_;
+        return {&table_.value(idx), true};
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::insert(const K& key, const V& value) {
+        return tryEmplace(key, value).second;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::insert(K&& key, V&& value) {
+        return tryEmplace(std::move(key), std::move(value)).second;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename... Args>
+    std::pair<V*, bool> HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::emplace(Args&&... args) {
+        std::pair<K, V> entry(std::forward<Args>(args)...);
+        return tryEmplace(std::move(entry.first), std::move(entry.second));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename KeyArg, typename M>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::insertOrAssign(KeyArg&& key, M&& value) {
+        // tryEmplace leaves value untouched unless it inserts.
+        auto [slot, inserted] = tryEmplace(std::forward<KeyArg>(key), std::forward<M>(value));
+        if (!inserted && slot) *slot = std::forward<M>(value);
+        return inserted;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::removeKey(const Q& key) {
+        migrate(kMigrationStep);
+        size_t hash = hasher_(key);
+
+        size_t idx = findIndexIn(table_, key, hash);
+        if (idx != table_.size()) {
+            release(idx);
+            --elementCount_;
+            return true;
+        }
+
+        if (!oldTable_.empty()) {
+            // The old array is dropped once migrated; its tombstones are not counted.
+            idx = findIndexIn(oldTable_, key, hash);
+            if (idx != oldTable_.size()) {
+                oldTable_.setState(idx, State::Tombstone);
                 --elementCount_;
                 return true;
             }
-            // Tombstone or mismatch -> keep probing
         }
-        return false; // full scan, key not found
+        return false;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::release(size_t index) {
+        if constexpr (std::is_same_v<Probe, LinearProbe>) {
+            // Linear probe chains are contiguous runs: if the next bucket is
+            // empty, every chain through `index` stops there anyway, and the
+            // same then holds for the tombstones right before it.
+            size_t n = table_.size();
+            if (table_.state((index + 1) % n) == State::Empty) {
+                table_.setState(index, State::Empty);
+                for (size_t i = (index + n - 1) % n; i != index && table_.state(i) == State::Tombstone;
+                     i = (i + n - 1) % n) {
+                    table_.setState(i, State::Empty);
+                    --tombstoneCount_;
+                }
+                return;
+            }
+        }
+        table_.setState(index, State::Tombstone);
+        ++tombstoneCount_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::remove(const K& key) {
+        return removeKey(key);
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::find(const K& key) {
-        for (size_t attempt = 0; attempt < table_.size(); ++attempt) {
-            size_t idx = probeIndex(key, attempt);
-            auto& bucket = table_[idx];
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::remove(const Q& key) {
+        return removeKey(key);
+    }
 
-            if (bucket.state == State::Empty) return nullptr;
-            if (bucket.state == State::Occupied && keyEqual_(bucket.key, key)) return &bucket.value;
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::find(const K& key) {
+        return const_cast<V*>(locate(key, hasher_(key)));
+    }
 
-            // else: keep probing (Tombstone or mismatch)
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    const V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::find(const K& key) const {
+        return locate(key, hasher_(key));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+    V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::find(const Q& key) {
+        return const_cast<V*>(locate(key, hasher_(key)));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    template<typename Q> requires TransparentLookup<Hash, KeyEqual>
+    const V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::find(const Q& key) const {
+        return locate(key, hasher_(key));
+    }
+
+    // Batch operations
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::prefetchHome(size_t hash) const {
+        table_.prefetch(Capacity::reduce(hash, table_.size()));
+        if (!oldTable_.empty()) oldTable_.prefetch(Capacity::reduce(hash, oldTable_.size()));
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::findBatch(const K* keys, size_t n, V** outValues) {
+        size_t found = 0;
+        size_t hashes[kBatchGroup];
+
+        for (size_t base = 0; base < n; base += kBatchGroup) {
+            size_t count = std::min(kBatchGroup, n - base);
+
+            // Pass 1: hash the group and start loading every home bucket.
+            for (size_t i = 0; i < count; ++i) {
+                hashes[i] = hasher_(keys[base + i]);
+                prefetchHome(hashes[i]);
+            }
+
+            // Pass 2: probe; the home buckets are in flight or already cached.
+            for (size_t i = 0; i < count; ++i) {
+                V* value = const_cast<V*>(locate(keys[base + i], hashes[i]));
+                outValues[base + i] = value;
+                if (value) ++found;
+            }
         }
-        return nullptr;
+        return found;
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    const V* HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::find(const K& key) const {
-        for (size_t attempt = 0; attempt < table_.size(); ++attempt) {
-            size_t idx = probeIndex(key, attempt);
-            const auto& bucket = table_[idx];
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::insertBatch(const K* keys, const V* values, size_t n) {
+        if (!incremental_ && oldTable_.empty()) {
+            // Size for the whole batch up front, so no prefetched bucket moves mid-group.
+            size_t target = table_.size();
+            while (elementCount_ + n > maxLoadFactor_ * target) target = Capacity::grow(target);
+            if (target != table_.size()) rehash(target);
+        }
+
+        size_t inserted = 0;
+        size_t hashes[kBatchGroup];
 
-            if (bucket.state == State::Empty) return nullptr;
-            if (bucket.state == State::Occupied && keyEqual_(bucket.key, key)) return &bucket.value;
+        for (size_t base = 0; base < n; base += kBatchGroup) {
+            size_t count = std::min(kBatchGroup, n - base);
 
-            // else: keep probing (Tombstone or mismatch)
+            for (size_t i = 0; i < count; ++i) {
+                hashes[i] = hasher_(keys[base + i]);
+                prefetchHome(hashes[i]);
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                if (tryEmplaceHashed(hashes[i], keys[base + i], values[base + i]).second) ++inserted;
+            }
         }
-        return nullptr;
+        return inserted;
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::size() const {
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::size() const {
         return elementCount_;
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::clear() {
-        for (auto& bucket : table_) { bucket.state = State::Empty; }
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::capacity() const {
+        return table_.size();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::tombstoneCount() const {
+        return tombstoneCount_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::compact() {
+        rehash(table_.size());
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    void HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::clear() {
+        table_.reset();
+        oldTable_ = Storage();
+        migrateCursor_ = 0;
         elementCount_ = 0;
+        tombstoneCount_ = 0;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    bool HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::isRehashing() const {
+        return !oldTable_.empty();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    HashTableStats HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::stats() const {
+        HashTableStats stats;
+        stats.size = elementCount_;
+        stats.capacity = table_.size();
+        stats.loadFactor = table_.empty() ? 0.0f : static_cast<float>(elementCount_) / table_.size();
+        stats.tombstones = tombstoneCount_;
+
+        for (const auto* table : {&table_, &oldTable_}) {
+            for (size_t i = 0; i < table->size(); ++i) {
+                if (table->state(i) != State::Occupied) continue;
+
+                // Replay the probe sequence up to where the entry sits.
+                size_t length = 1;
+                for (ProbeSequence seq = probe(hasher_(table->key(i)), table->size()); seq.index() != i; seq.next()) {
+                    ++length;
+                }
+                stats.recordProbe(length);
+            }
+        }
+        stats.finishProbes();
+        rehashCounters_.report(stats);
+        return stats;
     }
 
-    template<typename K, typename V, typename Hash, typename KeyEqual>
-    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual>::nextCapacity() const {
-        return table_.size() == 0 ? 1 : table_.size() * 2;
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Probe, typename Capacity, typename Layout>
+    size_t HashTableOpenAddressingBase<K, V, Hash, KeyEqual, Probe, Capacity, Layout>::nextCapacity() const {
+        return Capacity::grow(table_.size());
     }
 
-} // namespace dsa
\ No newline at end of file
+} // namespace dsa
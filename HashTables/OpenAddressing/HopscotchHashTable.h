@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include "../CapacityPolicies.h"
+#include "../Hash.h"
+
+namespace dsa {
+    /**
+     * @brief Open addressing hash table using hopscotch hashing.
+     *
+     * Every entry lives within kNeighborhood buckets of its home bucket, and
+     * each bucket keeps a hop bitmap whose bit i says that bucket home+i holds
+     * an entry homed here. A lookup reads the home bitmap and compares only the
+     * keys at the set bits, so it never leaves the neighborhood and never
+     * probes past unrelated entries.
+     *
+     * Insert finds the nearest empty bucket by linear probing. While it is too
+     * far from home, an entry between the two that can legally move into it
+     * (its own home stays within reach) is hopped forward, bringing the empty
+     * bucket closer. If no such entry exists the table doubles.
+     *
+     * Keys with equal full hashes share one home bucket at every size, and a
+     * home's neighborhood holds only kNeighborhood entries, so no amount of
+     * hopping makes room for one more. An insert that still overflows its
+     * neighborhood after kMaxGrowAttempts doublings throws std::length_error
+     * and leaves the existing entries in the enlarged table.
+     *
+     * Removal just clears the bucket and its hop bit, so there are no
+     * tombstones. With a 32-bucket neighborhood hopping rarely fails below
+     * about 90% load, which is the default maximum load factor.
+     *
+     * @tparam K The key type.
+     * @tparam V The value type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     */
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>
+    >
+    class HopscotchHashTable {
+    protected:
+        /// @brief Maximum distance of an entry from its home bucket, plus one.
+        static constexpr size_t kNeighborhood = 32;
+
+        /// @brief Doublings one insert may trigger before the hash is deemed too weak.
+        static constexpr size_t kMaxGrowAttempts = 3;
+
+        /**
+         * @brief A bucket in the hash table. `hop` describes the entries homed
+         * here; `occupied` describes this bucket's own entry.
+         */
+        struct Bucket {
+            K        key;
+            V        value;
+            uint32_t hop = 0;
+            bool     occupied = false;
+        };
+
+        std::vector<Bucket> table_;              ///< underlying bucket array; size is a power of two
+        size_t              elementCount_ = 0;   ///< number of live entries
+        float               maxLoadFactor_;      ///< when to trigger rehash
+        Hash                hasher_;             ///< primary hash function
+        KeyEqual            keyEqual_;           ///< key equality check
+
+    public:
+        /**
+         * @brief Constructs the hash table.
+         * @param capacity Initial number of buckets; rounded up to a power of two.
+         * @param maxLoadFactor The load factor at which to trigger a rehash.
+         */
+        explicit
+        HopscotchHashTable(size_t capacity = 16,
+                           float  maxLoadFactor = 0.9f);
+
+        /**
+         * @brief Inserts a key/value pair. Returns false if key already exists.
+         * @throws std::length_error if the key cannot be placed even after
+         *         kMaxGrowAttempts doublings (more than kNeighborhood keys with one hash).
+         */
+        bool insert(const K& key, const V& value);
+
+        /// @brief Removes a key.
+        /// @return false if key is not found.
+        bool remove(const K& key);
+
+        /// @brief Finds a key and returns a pointer to its value. Worst case O(kNeighborhood).
+        /// @return Pointer to the value, or nullptr if not found.
+        V* find(const K& key);
+        const V* find(const K& key) const;
+
+        /// @brief Returns the number of elements in the table.
+        size_t size() const;
+
+        /// @brief Returns the number of buckets.
+        size_t capacity() const;
+
+        /// @brief Returns size() / capacity().
+        float loadFactor() const;
+
+        /// @brief Returns the largest distance of any entry from its home bucket. O(capacity).
+        size_t maxDisplacement() const;
+
+        /// @brief Clears the hash table, keeping its capacity.
+        void clear();
+
+    protected:
+        /// @brief Returns the home bucket of a key.
+        size_t homeIndex(const K& key) const;
+
+        /// @brief Returns the bucket index holding key, or table_.size() if absent.
+        size_t findIndex(const K& key) const;
+
+        /**
+         * @brief Places an entry known to be absent, hopping others to make room.
+         * @return false if the neighborhood could not be freed; key and value are
+         *         then untouched (entries may have been hopped, which is harmless).
+         */
+        bool place(K&& key, V&& value);
+
+        /// @brief Moves all entries into a table of the given capacity.
+        void rehash(size_t newCapacity);
+    };
+} // namespace dsa
+
+#include "HopscotchHashTable.tpp"
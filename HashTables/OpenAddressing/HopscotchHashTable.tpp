@@ -0,0 +1,182 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace dsa {
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    HopscotchHashTable<K, V, Hash, KeyEqual>::HopscotchHashTable(
+        size_t capacity,
+        float maxLoadFactor
+    )
+        : table_(PowerOfTwoMask::normalize(capacity)),
+          elementCount_(0),
+          maxLoadFactor_(maxLoadFactor),
+          hasher_(),
+          keyEqual_()
+    {}
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HopscotchHashTable<K, V, Hash, KeyEqual>::homeIndex(const K& key) const {
+        // Hash<K> already mixes, so the low bits are usable as they are.
+        return PowerOfTwoMask::reduce(hasher_(key), table_.size());
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HopscotchHashTable<K, V, Hash, KeyEqual>::findIndex(const K& key) const {
+        const size_t mask = table_.size() - 1;
+        size_t home = homeIndex(key);
+
+        // Only the buckets flagged in the home bitmap can hold the key.
+        for (uint32_t hop = table_[home].hop; hop != 0; hop &= hop - 1) {
+            size_t idx = (home + static_cast<size_t>(std::countr_zero(hop))) & mask;
+            if (keyEqual_(table_[idx].key, key)) return idx;
+        }
+        return table_.size();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool HopscotchHashTable<K, V, Hash, KeyEqual>::place(K&& key, V&& value) {
+        const size_t mask = table_.size() - 1;
+        const size_t home = homeIndex(key);
+
+        // Nearest empty bucket at or after home.
+        size_t free = home;
+        size_t dist = 0;
+        while (table_[free].occupied) {
+            if (++dist == table_.size()) return false; // completely full
+            free = (free + 1) & mask;
+        }
+
+        // Hop the empty bucket back until it is inside home's neighborhood.
+        while (dist >= kNeighborhood) {
+            bool hopped = false;
+
+            // Try the farthest candidate homes first: each hop then gains the most.
+            for (size_t back = kNeighborhood - 1; back > 0 && !hopped; --back) {
+                size_t candidate = (free - back) & mask;
+                // Entries homed at candidate that sit before free can move into it.
+                uint32_t movable = table_[candidate].hop & ((uint32_t{1} << back) - 1);
+                if (movable == 0) continue;
+
+                size_t offset = static_cast<size_t>(std::countr_zero(movable));
+                size_t from = (candidate + offset) & mask;
+
+                table_[free].key = std::move(table_[from].key);
+                table_[free].value = std::move(table_[from].value);
+                table_[free].occupied = true;
+                table_[from].occupied = false;
+                table_[candidate].hop = (table_[candidate].hop & ~(uint32_t{1} << offset)) | (uint32_t{1} << back);
+
+                dist -= back - offset;
+                free = from;
+                hopped = true;
+            }
+            if (!hopped) return false;
+        }
+
+        table_[free].key = std::move(key);
+        table_[free].value = std::move(value);
+        table_[free].occupied = true;
+        table_[home].hop |= uint32_t{1} << dist;
+        ++elementCount_;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void HopscotchHashTable<K, V, Hash, KeyEqual>::rehash(size_t newCapacity) {
+        std::vector<Bucket> oldTable = std::move(table_);
+        table_ = std::vector<Bucket>(newCapacity);
+        elementCount_ = 0;
+
+        for (auto& bucket : oldTable) {
+            if (!bucket.occupied) continue;
+            // place() gives up without moving the entry when no empty bucket
+            // can be hopped into its neighborhood; double and retry. insert()
+            // keeps each home under kNeighborhood shared-hash keys, so the
+            // larger table spreads the other entries out of the way.
+            while (!place(std::move(bucket.key), std::move(bucket.value))) {
+                rehash(PowerOfTwoMask::grow(table_.size()));
+            }
+        }
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool HopscotchHashTable<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
+        if (findIndex(key) != table_.size()) return false; // Duplicate key
+
+        // Rehash if over load factor
+        if ((elementCount_ + 1.0f) / table_.size() > maxLoadFactor_) {
+            rehash(PowerOfTwoMask::grow(table_.size()));
+        }
+
+        K newKey = key;
+        V newValue = value;
+        for (size_t attempt = 0; !place(std::move(newKey), std::move(newValue)); ++attempt) {
+            if (attempt == kMaxGrowAttempts) {
+                throw std::length_error("HopscotchHashTable::insert: no slot after repeated growth; "
+                                        "too many keys share a hash.");
+            }
+            rehash(PowerOfTwoMask::grow(table_.size())); // neighborhood could not be freed: grow
+        }
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool HopscotchHashTable<K, V, Hash, KeyEqual>::remove(const K& key) {
+        size_t idx = findIndex(key);
+        if (idx == table_.size()) return false;
+
+        size_t home = homeIndex(key);
+        table_[home].hop &= ~(uint32_t{1} << ((idx - home) & (table_.size() - 1)));
+        table_[idx].occupied = false;
+        --elementCount_;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    V* HopscotchHashTable<K, V, Hash, KeyEqual>::find(const K& key) {
+        size_t idx = findIndex(key);
+        return idx == table_.size() ? nullptr : &table_[idx].value;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    const V* HopscotchHashTable<K, V, Hash, KeyEqual>::find(const K& key) const {
+        size_t idx = findIndex(key);
+        return idx == table_.size() ? nullptr : &table_[idx].value;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HopscotchHashTable<K, V, Hash, KeyEqual>::size() const {
+        return elementCount_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HopscotchHashTable<K, V, Hash, KeyEqual>::capacity() const {
+        return table_.size();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    float HopscotchHashTable<K, V, Hash, KeyEqual>::loadFactor() const {
+        return static_cast<float>(elementCount_) / table_.size();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HopscotchHashTable<K, V, Hash, KeyEqual>::maxDisplacement() const {
+        size_t longest = 0;
+        for (const auto& bucket : table_) {
+            if (bucket.hop != 0) longest = std::max<size_t>(longest, std::bit_width(bucket.hop) - 1);
+        }
+        return longest;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void HopscotchHashTable<K, V, Hash, KeyEqual>::clear() {
+        for (auto& bucket : table_) {
+            bucket.hop = 0;
+            bucket.occupied = false;
+        }
+        elementCount_ = 0;
+    }
+
+} // namespace dsa
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+
+namespace dsa {
+    /**
+     * Probe policies for HashTableOpenAddressingBase.
+     *
+     * A policy exposes a nested `Sequence`, constructed once per operation from
+     * the home bucket (the hash reduced by the table's capacity policy), the
+     * full hash, and the capacity. index() is the bucket to inspect and next()
+     * advances to the following one. Each step is an add plus a conditional
+     * subtract, so the key is hashed once and no division happens inside the
+     * probe loop. Every policy visits all buckets within `capacity` steps when
+     * the capacity is a power of two; DoubleHashProbe also does on prime ones.
+     */
+
+    /// @brief Linear probing: h, h+1, h+2, ...
+    struct LinearProbe {
+        class Sequence {
+        public:
+            Sequence(size_t home, size_t /*hash*/, size_t capacity) : index_(home), capacity_(capacity) {}
+
+            size_t index() const { return index_; }
+            void next() {
+                if (++index_ == capacity_) index_ = 0;
+            }
+
+        private:
+            size_t index_;
+            size_t capacity_;
+        };
+    };
+
+    /**
+     * @brief Quadratic probing with triangular offsets: h, h+1, h+3, h+6, ...
+     *
+     * Offsets i(i+1)/2 rather than i^2 are generated by adding 1, 2, 3, ...,
+     * and unlike i^2 they reach every bucket of a power-of-two table.
+     */
+    struct QuadraticProbe {
+        class Sequence {
+        public:
+            Sequence(size_t home, size_t /*hash*/, size_t capacity) : index_(home), capacity_(capacity) {}
+
+            size_t index() const { return index_; }
+            void next() {
+                // step_ < capacity_ within one sweep, so one subtraction suffices.
+                index_ += ++step_;
+                if (index_ >= capacity_) index_ -= capacity_;
+            }
+
+        private:
+            size_t index_;
+            size_t step_ = 0;
+            size_t capacity_;
+        };
+    };
+
+    /**
+     * @brief Double hashing: h1, h1+s, h1+2s, ... with s derived from the same hash.
+     *
+     * The step comes from the hash's upper bits via secondaryHash(). It is made
+     * odd on even capacities so that it is coprime with a power of two; with a
+     * prime capacity every step in [1, capacity) already is.
+     */
+    struct DoubleHashProbe {
+        /**
+         * @brief A secondary hash function for double hashing.
+         *
+         * It's crucial that this function never returns zero and is less than the capacity.
+         * On a power-of-two capacity the step is the masked bits forced odd, with no
+         * division; otherwise it is `1 + (h2(key) % (capacity - 1))`.
+         * @param h2 The result of a secondary hash calculation on the key.
+         * @param cap The current capacity of the table.
+         * @return The step size for probing.
+         */
+        static size_t secondaryHash(size_t h2, size_t cap) {
+            if (cap < 2) return 1;
+            if ((cap & (cap - 1)) == 0) return (h2 | 1) & (cap - 1);
+            size_t step = 1 + (h2 % (cap - 1));
+            return (cap & 1) ? step : (step | 1);
+        }
+
+        class Sequence {
+        public:
+            Sequence(size_t home, size_t hash, size_t capacity)
+                : index_(home),
+                  step_(secondaryHash(hash >> (sizeof(size_t) * 4), capacity)),
+                  capacity_(capacity) {}
+
+            size_t index() const { return index_; }
+            void next() {
+                index_ += step_;
+                if (index_ >= capacity_) index_ -= capacity_;
+            }
+
+        private:
+            size_t index_;
+            size_t step_;
+            size_t capacity_;
+        };
+    };
+
+} // namespace dsa
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <functional>
+#include "../CapacityPolicies.h"
+#include "../Hash.h"
+
+namespace dsa {
+    /**
+     * @brief Open addressing hash table using Robin Hood linear probing.
+     *
+     * Every bucket records how far its entry sits from its home bucket. On
+     * insert, an entry that has travelled further than the occupant of a bucket
+     * takes that bucket, and the displaced occupant continues probing ("take
+     * from the rich"). This keeps probe lengths tightly clustered around the
+     * mean, and lets a lookup stop as soon as it passes a bucket whose entry is
+     * closer to home than the key would be.
+     *
+     * Deletion shifts the following entries of the cluster back by one instead
+     * of leaving a tombstone, so update-heavy workloads never accumulate dead
+     * buckets and lookups stay as fast as on a freshly built table.
+     *
+     * @tparam K The key type.
+     * @tparam V The value type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     */
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>
+    >
+    class RobinHoodHashTable {
+    protected:
+        /**
+         * @brief A bucket in the hash table. `dist` is the probe distance plus
+         * one, so 0 marks an empty bucket.
+         */
+        struct Bucket {
+            K        key;
+            V        value;
+            uint32_t dist = 0;
+        };
+
+        std::vector<Bucket> table_;              ///< underlying bucket array; size is a power of two
+        size_t              elementCount_ = 0;   ///< number of live entries
+        float               maxLoadFactor_;      ///< when to trigger rehash
+        Hash                hasher_;             ///< primary hash function
+        KeyEqual            keyEqual_;           ///< key equality check
+
+    public:
+        /**
+         * @brief Constructs the hash table.
+         * @param capacity Initial number of buckets; rounded up to a power of two.
+         * @param maxLoadFactor The load factor at which to trigger a rehash.
+         */
+        explicit
+        RobinHoodHashTable(size_t capacity = 16,
+                           float  maxLoadFactor = 0.9f);
+
+        /// @brief Inserts a key/value pair. Returns false if key already exists.
+        bool insert(const K& key, const V& value);
+
+        /// @brief Removes a key, shifting the rest of its cluster back.
+        /// @return false if key is not found.
+        bool remove(const K& key);
+
+        /// @brief Finds a key and returns a pointer to its value.
+        /// @return Pointer to the value, or nullptr if not found.
+        V* find(const K& key);
+        const V* find(const K& key) const;
+
+        /// @brief Returns the number of elements in the table.
+        size_t size() const;
+
+        /// @brief Returns the longest probe distance currently in the table. O(capacity).
+        size_t maxProbeDistance() const;
+
+        /// @brief Clears the hash table, resetting it to its initial state.
+        void clear();
+
+    protected:
+        /// @brief Returns the home bucket of a key.
+        size_t homeIndex(const K& key) const;
+
+        /// @brief Returns the bucket index holding key, or table_.size() if absent.
+        size_t findIndex(const K& key) const;
+
+        /// @brief Places an entry known to be absent, displacing richer entries.
+        void place(Bucket incoming);
+
+        /// @brief Doubles the table capacity and re-inserts all elements.
+        void rehash(size_t newCapacity);
+    };
+} // namespace dsa
+
+#include "RobinHoodHashTable.tpp"
@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <utility>
+
+namespace dsa {
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    RobinHoodHashTable<K, V, Hash, KeyEqual>::RobinHoodHashTable(
+        size_t capacity,
+        float maxLoadFactor
+    )
+        : table_(PowerOfTwoMask::normalize(capacity)),
+          elementCount_(0),
+          maxLoadFactor_(maxLoadFactor),
+          hasher_(),
+          keyEqual_()
+    {}
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t RobinHoodHashTable<K, V, Hash, KeyEqual>::homeIndex(const K& key) const {
+        // Hash<K> already mixes, so the low bits are usable as they are.
+        return PowerOfTwoMask::reduce(hasher_(key), table_.size());
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t RobinHoodHashTable<K, V, Hash, KeyEqual>::findIndex(const K& key) const {
+        const size_t mask = table_.size() - 1;
+        size_t idx = homeIndex(key);
+
+        for (uint32_t dist = 1; dist <= table_.size(); ++dist, idx = (idx + 1) & mask) {
+            const auto& bucket = table_[idx];
+            // An empty bucket, or an entry closer to home than we would be,
+            // means the key would have been placed here: it is absent.
+            if (bucket.dist < dist) break;
+            if (bucket.dist == dist && keyEqual_(bucket.key, key)) return idx;
+        }
+        return table_.size();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void RobinHoodHashTable<K, V, Hash, KeyEqual>::place(Bucket incoming) {
+        const size_t mask = table_.size() - 1;
+        size_t idx = homeIndex(incoming.key);
+        incoming.dist = 1;
+
+        for (;; idx = (idx + 1) & mask, ++incoming.dist) {
+            auto& bucket = table_[idx];
+            if (bucket.dist == 0) {
+                bucket = std::move(incoming);
+                ++elementCount_;
+                return;
+            }
+            // Take from the rich: the entry nearer its home moves on instead.
+            if (bucket.dist < incoming.dist) std::swap(bucket, incoming);
+        }
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void RobinHoodHashTable<K, V, Hash, KeyEqual>::rehash(size_t newCapacity) {
+        std::vector<Bucket> oldTable = std::move(table_);
+
+        table_.clear();
+        table_.resize(newCapacity);
+        elementCount_ = 0;
+
+        for (auto& bucket : oldTable) {
+            if (bucket.dist != 0) place(std::move(bucket));
+        }
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool RobinHoodHashTable<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
+        if (findIndex(key) != table_.size()) return false; // Duplicate key
+
+        // Rehash if over load factor (or full, whatever the factor says)
+        if ((elementCount_ + 1.0f) / table_.size() > maxLoadFactor_ || elementCount_ == table_.size()) {
+            rehash(PowerOfTwoMask::grow(table_.size()));
+        }
+        place(Bucket{ key, value, 0 });
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool RobinHoodHashTable<K, V, Hash, KeyEqual>::remove(const K& key) {
+        size_t idx = findIndex(key);
+        if (idx == table_.size()) return false;
+
+        // Backward shift: pull each following displaced entry one step closer
+        // to home until the cluster ends or an entry is already at home.
+        const size_t mask = table_.size() - 1;
+        size_t next = (idx + 1) & mask;
+        while (table_[next].dist > 1) {
+            table_[idx] = std::move(table_[next]);
+            --table_[idx].dist;
+            idx = next;
+            next = (next + 1) & mask;
+        }
+        table_[idx].dist = 0;
+        --elementCount_;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    V* RobinHoodHashTable<K, V, Hash, KeyEqual>::find(const K& key) {
+        size_t idx = findIndex(key);
+        return idx == table_.size() ? nullptr : &table_[idx].value;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    const V* RobinHoodHashTable<K, V, Hash, KeyEqual>::find(const K& key) const {
+        size_t idx = findIndex(key);
+        return idx == table_.size() ? nullptr : &table_[idx].value;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t RobinHoodHashTable<K, V, Hash, KeyEqual>::size() const {
+        return elementCount_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t RobinHoodHashTable<K, V, Hash, KeyEqual>::maxProbeDistance() const {
+        uint32_t longest = 0;
+        for (const auto& bucket : table_) longest = std::max(longest, bucket.dist);
+        return longest == 0 ? 0 : longest - 1;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void RobinHoodHashTable<K, V, Hash, KeyEqual>::clear() {
+        for (auto& bucket : table_) { bucket.dist = 0; }
+        elementCount_ = 0;
+    }
+
+} // namespace dsa
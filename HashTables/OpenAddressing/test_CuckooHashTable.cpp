@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+#include "CuckooHashTable.h"
+
+using namespace dsa;
+
+TEST(CuckooHashTable, FillsPastNinetyFivePercentWithoutGrowing) {
+    // Displacement searches keep placing keys long after both candidate
+    // buckets of new keys start coming up full.
+    CuckooHashTable<int, int> table(1 << 14, 0.97f);
+    const size_t capacity = table.capacity();
+    const int target = static_cast<int>(capacity * 0.96);
+
+    for (int i = 0; i < target; ++i) ASSERT_TRUE(table.insert(i, -i));
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT_GT(table.loadFactor(), 0.95f);
+
+    for (int i = 0; i < target; ++i) {
+        ASSERT_NE(table.find(i), nullptr) << i;
+        EXPECT_EQ(*table.find(i), -i);
+    }
+    EXPECT_EQ(table.find(target), nullptr);
+}
+
+TEST(CuckooHashTable, GrowsWhenFullAndKeepsEverything) {
+    CuckooHashTable<int, int> table(8, 1.0f);
+    for (int i = 0; i < 5000; ++i) ASSERT_TRUE(table.insert(i, i * 2));
+    EXPECT_EQ(table.size(), 5000u);
+    EXPECT_GE(table.capacity(), 5000u);
+    for (int i = 0; i < 5000; ++i) ASSERT_EQ(*table.find(i), i * 2);
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include "HopscotchHashTable.h"
+
+using namespace dsa;
+
+namespace {
+    // Exposes the buckets to check the hop bitmaps against the entries.
+    template<typename Hash = Hash<int>>
+    struct InspectableHopscotch : HopscotchHashTable<int, int, Hash> {
+        using HopscotchHashTable<int, int, Hash>::HopscotchHashTable;
+
+        // Every occupied bucket is flagged in its home's bitmap, and every
+        // set bit points at an entry homed there.
+        ::testing::AssertionResult neighborhoodsConsistent() const {
+            const auto& table = this->table_;
+            const size_t mask = table.size() - 1;
+            const size_t reach = this->kNeighborhood;
+            for (size_t i = 0; i < table.size(); ++i) {
+                if (table[i].occupied) {
+                    size_t home = this->homeIndex(table[i].key);
+                    size_t dist = (i - home) & mask;
+                    if (dist >= reach || !(table[home].hop & (uint32_t{1} << dist))) {
+                        return ::testing::AssertionFailure() << "bucket " << i << " not flagged at home " << home;
+                    }
+                }
+                for (size_t d = 0; d < reach; ++d) {
+                    if (!(table[i].hop & (uint32_t{1} << d))) continue;
+                    const auto& bucket = table[(i + d) & mask];
+                    if (!bucket.occupied || this->homeIndex(bucket.key) != i) {
+                        return ::testing::AssertionFailure() << "bit " << d << " of bucket " << i << " is stale";
+                    }
+                }
+            }
+            return ::testing::AssertionSuccess();
+        }
+    };
+
+    // Sends every key to the same home bucket.
+    struct ConstantHash {
+        size_t operator()(int) const { return 0x5eed; }
+    };
+}
+
+TEST(HopscotchHashTable, RandomChurnKeepsHopBitmapsExact) {
+    // Correctness of lookups under churn is covered by the shared typed
+    // suite; here the hop bitmaps are checked against the entries themselves.
+    std::mt19937 rng(5);
+    InspectableHopscotch<> table;
+    for (int step = 0; step < 200000; ++step) {
+        int key = static_cast<int>(rng() % 3000);
+        if (rng() % 2) {
+            table.insert(key, step);
+        } else {
+            table.remove(key);
+        }
+        if (step % 10000 == 0) {
+            ASSERT_TRUE(table.neighborhoodsConsistent()) << "step " << step;
+        }
+    }
+    EXPECT_TRUE(table.neighborhoodsConsistent());
+}
+
+TEST(HopscotchHashTable, FailedInsertLeavesHopBitmapsExact) {
+    // The throw itself is covered by the shared suite; here the bitmaps are
+    // checked after growth gave up partway.
+    InspectableHopscotch<ConstantHash> table;
+    for (int i = 0; i < 32; ++i) ASSERT_TRUE(table.insert(i, i));
+    EXPECT_THROW(table.insert(32, 32), std::length_error);
+    EXPECT_TRUE(table.neighborhoodsConsistent());
+}
+
+TEST(HopscotchHashTable, HighLoadKeepsEveryKeyInItsNeighborhood) {
+    InspectableHopscotch<> table(1 << 14, 0.95f);
+    const size_t capacity = table.capacity();
+    const int target = static_cast<int>(capacity * 0.9);
+
+    for (int i = 0; i < target; ++i) ASSERT_TRUE(table.insert(i, -i));
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT_GT(table.loadFactor(), 0.89f);
+    EXPECT_TRUE(table.neighborhoodsConsistent());
+
+    for (int i = 0; i < target; ++i) {
+        ASSERT_NE(table.find(i), nullptr) << i;
+        EXPECT_EQ(*table.find(i), -i);
+    }
+    EXPECT_EQ(table.find(target), nullptr);
+}
+
+TEST(HopscotchHashTable, UpdateHeavyWorkloadLeavesNoTombstones) {
+    InspectableHopscotch<> table(1024);
+    for (int i = 0; i < 800; ++i) table.insert(i, i);
+    for (int i = 800; i < 100000; ++i) {
+        ASSERT_TRUE(table.remove(i - 800));
+        ASSERT_TRUE(table.insert(i, i));
+    }
+    EXPECT_EQ(table.size(), 800u);
+    EXPECT_EQ(table.capacity(), 1024u);
+    EXPECT_TRUE(table.neighborhoodsConsistent());
+    for (int i = 100000 - 800; i < 100000; ++i) ASSERT_NE(table.find(i), nullptr);
+}
@@ -1,10 +1,30 @@
 #include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 #include "LinearProbingHashTable.h"
 #include "QuadraticProbingHashTable.h"
 #include "DoubleHashingHashTable.h"
+#include "RobinHoodHashTable.h"
+#include "CuckooHashTable.h"
+#include "HopscotchHashTable.h"
+#include "HashSet.h"
 
 using namespace dsa;
 
+template <typename Capacity>
+using LinearWith = LinearProbingHashTable<std::string, int, Hash<std::string>, std::equal_to<std::string>, Capacity>;
+template <typename Capacity>
+using DoubleWith = DoubleHashingHashTable<std::string, int, Hash<std::string>, std::equal_to<std::string>, Capacity>;
+using LinearSplit = LinearProbingHashTable<std::string, int, Hash<std::string>, std::equal_to<std::string>,
+                                           PowerOfTwoMask, SplitBuckets>;
+using QuadraticSplit = QuadraticProbingHashTable<std::string, int, Hash<std::string>, std::equal_to<std::string>,
+                                                 PowerOfTwoMask, SplitBuckets>;
+
 // ---------- Shared Typed Test Suite ----------
 
 template <typename T>
@@ -61,12 +81,69 @@ TYPED_TEST_P(OpenAddressingHashTableTest, ResizeAndFindAll) {
     EXPECT_EQ(this->table.size(), 50);
 }
 
+TYPED_TEST_P(OpenAddressingHashTableTest, FillsEveryBucket) {
+    // Load factor 1.0 never rehashes, so every probe sequence must reach
+    // the last free bucket (of a power-of-two table; prime ones round 16 up).
+    TypeParam full(16, 1.0f);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_TRUE(full.insert("key" + std::to_string(i), i));
+    }
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_NE(full.find("key" + std::to_string(i)), nullptr);
+        EXPECT_EQ(*full.find("key" + std::to_string(i)), i);
+    }
+    EXPECT_EQ(full.find("missing"), nullptr);
+    EXPECT_FALSE(full.remove("missing"));
+}
+
+TYPED_TEST_P(OpenAddressingHashTableTest, MatchesUnorderedMapUnderChurn) {
+    // Random inserts, removes and lookups over a small key space, checked
+    // step by step against std::unordered_map.
+    std::vector<std::string> keys;
+    for (int i = 0; i < 3000; ++i) keys.push_back("key" + std::to_string(i));
+
+    std::mt19937 rng(11);
+    std::unordered_map<std::string, int> ref;
+    for (int step = 0; step < 200000; ++step) {
+        const std::string& key = keys[rng() % keys.size()];
+        switch (rng() % 3) {
+        case 0:
+            ASSERT_EQ(this->table.insert(key, step), ref.emplace(key, step).second);
+            break;
+        case 1:
+            ASSERT_EQ(this->table.remove(key), ref.erase(key) == 1);
+            break;
+        default: {
+            const int* v = this->table.find(key);
+            auto it = ref.find(key);
+            ASSERT_EQ(v != nullptr, it != ref.end());
+            if (v) {
+                ASSERT_EQ(*v, it->second);
+            }
+        }
+        }
+    }
+    EXPECT_EQ(this->table.size(), ref.size());
+}
+
+TYPED_TEST_P(OpenAddressingHashTableTest, ClearAndReuse) {
+    for (int i = 0; i < 100; ++i) this->table.insert("key" + std::to_string(i), i);
+    this->table.clear();
+    EXPECT_EQ(this->table.size(), 0u);
+    EXPECT_EQ(this->table.find("key5"), nullptr);
+    EXPECT_TRUE(this->table.insert("key5", 50));
+    EXPECT_EQ(*this->table.find("key5"), 50);
+}
+
 REGISTER_TYPED_TEST_SUITE_P(
     OpenAddressingHashTableTest,
     InsertAndFind,
     DuplicateInsertFails,
     RemoveKey,
-    ResizeAndFindAll
+    ResizeAndFindAll,
+    FillsEveryBucket,
+    MatchesUnorderedMapUnderChurn,
+    ClearAndReuse
 );
 
 // ---------- Plug in All OA Types ----------
@@ -74,7 +151,14 @@ REGISTER_TYPED_TEST_SUITE_P(
 using OpenAddressingTypes = ::testing::Types<
     LinearProbingHashTable<std::string, int>,
     QuadraticProbingHashTable<std::string, int>,
-    DoubleHashingHashTable<std::string, int>
+    DoubleHashingHashTable<std::string, int>,
+    RobinHoodHashTable<std::string, int>,
+    CuckooHashTable<std::string, int>,
+    HopscotchHashTable<std::string, int>,
+    LinearWith<FibonacciReduce>,
+    DoubleWith<PowerOfTwoMask>,
+    LinearSplit,
+    QuadraticSplit
 >;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(
@@ -82,3 +166,317 @@ INSTANTIATE_TYPED_TEST_SUITE_P(
     OpenAddressingHashTableTest,
     OpenAddressingTypes
 );
+
+// ---------- Keys Sharing One Hash (tables that bound their growth) ----------
+
+namespace {
+    struct ConstantHash {
+        size_t operator()(int) const { return 0x5eed; }
+    };
+
+    // Keys with one hash that fit: both four-slot cuckoo buckets, or one
+    // 32-bucket hopscotch neighborhood.
+    template <typename T> constexpr int kSharedHashLimit = 0;
+    template <> constexpr int kSharedHashLimit<CuckooHashTable<int, int, ConstantHash>> = 8;
+    template <> constexpr int kSharedHashLimit<HopscotchHashTable<int, int, ConstantHash>> = 32;
+}
+
+template <typename T>
+class SharedHashTest : public ::testing::Test {};
+
+using BoundedGrowthTypes = ::testing::Types<
+    CuckooHashTable<int, int, ConstantHash>,
+    HopscotchHashTable<int, int, ConstantHash>
+>;
+TYPED_TEST_SUITE(SharedHashTest, BoundedGrowthTypes);
+
+TYPED_TEST(SharedHashTest, ThrowsInsteadOfGrowingForever) {
+    constexpr int limit = kSharedHashLimit<TypeParam>;
+    TypeParam table;
+    for (int i = 0; i < limit; ++i) ASSERT_TRUE(table.insert(i, i));
+    EXPECT_THROW(table.insert(limit, limit), std::length_error);
+
+    EXPECT_EQ(table.size(), static_cast<size_t>(limit));
+    EXPECT_LE(table.capacity(), 1024u);
+    for (int i = 0; i < limit; ++i) {
+        ASSERT_NE(table.find(i), nullptr) << i;
+        EXPECT_EQ(*table.find(i), i);
+    }
+    EXPECT_EQ(table.find(limit), nullptr);
+}
+
+// ---------- Incremental Rehash (tables built on HashTableOpenAddressingBase) ----------
+
+template <typename T>
+class IncrementalRehashTest : public ::testing::Test {};
+
+using ProbingTypes = ::testing::Types<
+    LinearProbingHashTable<std::string, int>,
+    QuadraticProbingHashTable<std::string, int>,
+    DoubleHashingHashTable<std::string, int>,
+    DoubleWith<PowerOfTwoMask>,
+    LinearSplit,
+    QuadraticSplit
+>;
+TYPED_TEST_SUITE(IncrementalRehashTest, ProbingTypes);
+
+TYPED_TEST(IncrementalRehashTest, KeepsEverythingDuringMigration) {
+    TypeParam table(16, 0.5f, true);
+    bool sawMigration = false;
+
+    for (int i = 0; i < 3000; ++i) {
+        ASSERT_TRUE(table.insert("key" + std::to_string(i), i));
+        if ((i / 2) % 5 != 0) {
+            ASSERT_FALSE(table.insert("key" + std::to_string(i / 2), -1)); // may sit in the old array
+        }
+        if (i % 5 == 0) {
+            ASSERT_TRUE(table.remove("key" + std::to_string(i)));
+        }
+        sawMigration |= table.isRehashing();
+    }
+    EXPECT_TRUE(sawMigration);
+    EXPECT_EQ(table.size(), 3000u - 600u);
+
+    for (int i = 0; i < 3000; ++i) {
+        const int* v = table.find("key" + std::to_string(i));
+        if (i % 5 == 0) {
+            EXPECT_EQ(v, nullptr);
+        } else {
+            ASSERT_NE(v, nullptr) << i;
+            EXPECT_EQ(*v, i);
+        }
+    }
+}
+
+// ---------- Tombstones ----------
+
+template <typename T>
+class TombstoneTest : public ::testing::Test {};
+TYPED_TEST_SUITE(TombstoneTest, ProbingTypes);
+
+TYPED_TEST(TombstoneTest, ChurnNeitherGrowsNorFillsWithTombstones) {
+    for (bool incremental : {false, true}) {
+        TypeParam table(64, 0.5f, incremental);
+        size_t capacity = table.capacity();
+
+        // A sliding window of 16 live keys over 20000 distinct ones.
+        for (int i = 0; i < 20000; ++i) {
+            ASSERT_TRUE(table.insert("key" + std::to_string(i), i));
+            if (i >= 16) {
+                ASSERT_TRUE(table.remove("key" + std::to_string(i - 16)));
+            }
+            ASSERT_LE(table.size() + table.tombstoneCount(), table.capacity() / 2);
+        }
+        EXPECT_EQ(table.capacity(), capacity);
+        EXPECT_EQ(table.size(), 16u);
+        for (int i = 20000 - 16; i < 20000; ++i) {
+            ASSERT_NE(table.find("key" + std::to_string(i)), nullptr) << i;
+        }
+    }
+}
+
+TYPED_TEST(TombstoneTest, CompactDropsTombstonesAndKeepsEntries) {
+    TypeParam table(256);
+    for (int i = 0; i < 100; ++i) table.insert("key" + std::to_string(i), i);
+    for (int i = 0; i < 100; i += 2) table.remove("key" + std::to_string(i));
+    EXPECT_GT(table.tombstoneCount(), 0u);
+    size_t capacity = table.capacity();
+
+    table.compact();
+    EXPECT_EQ(table.tombstoneCount(), 0u);
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT_EQ(table.size(), 50u);
+    for (int i = 0; i < 100; ++i) {
+        const int* v = table.find("key" + std::to_string(i));
+        if (i % 2 == 0) {
+            EXPECT_EQ(v, nullptr);
+        } else {
+            ASSERT_NE(v, nullptr);
+            EXPECT_EQ(*v, i);
+        }
+    }
+}
+
+TEST(TombstoneTest, LinearProbingRemoveAtEndOfRunLeavesNoTombstones) {
+    LinearProbingHashTable<int, int> table(1024);
+    for (int i = 0; i < 200; ++i) table.insert(i, i);
+    // Removing in reverse insertion order peels each run from its far end.
+    for (int i = 199; i >= 0; --i) table.remove(i);
+    EXPECT_EQ(table.tombstoneCount(), 0u);
+    EXPECT_EQ(table.size(), 0u);
+}
+
+// ---------- Statistics ----------
+
+template <typename T>
+class StatsTest : public ::testing::Test {};
+TYPED_TEST_SUITE(StatsTest, ProbingTypes);
+
+TYPED_TEST(StatsTest, ReportsLoadTombstonesAndProbeLengths) {
+    TypeParam table(4);
+    for (int i = 0; i < 1000; ++i) table.insert("key" + std::to_string(i), i);
+    for (int i = 0; i < 1000; i += 4) table.remove("key" + std::to_string(i));
+
+    HashTableStats stats = table.stats();
+    EXPECT_EQ(stats.size, 750u);
+    EXPECT_EQ(stats.capacity, table.capacity());
+    EXPECT_FLOAT_EQ(stats.loadFactor, 750.0f / table.capacity());
+    EXPECT_EQ(stats.tombstones, table.tombstoneCount());
+
+    size_t counted = 0;
+    for (size_t n : stats.probeHistogram) counted += n;
+    EXPECT_EQ(counted, 750u);
+    EXPECT_EQ(stats.probeHistogram.size(), stats.maxProbeLength);
+    EXPECT_GE(stats.meanProbeLength, 1.0);
+    EXPECT_LE(stats.meanProbeLength, static_cast<double>(stats.maxProbeLength));
+#if DSA_HASH_TABLE_STATS
+    EXPECT_GT(stats.rehashCount, 0u);
+#else
+    EXPECT_EQ(stats.rehashCount, 0u);
+#endif
+}
+
+// ---------- HashSet ----------
+
+TEST(HashSet, InsertContainsRemove) {
+    HashSet<std::string, Hash<std::string>, std::equal_to<>> set(4);
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_TRUE(set.insert("a"));
+    EXPECT_FALSE(set.isEmpty());
+    EXPECT_FALSE(set.insert("a"));
+    EXPECT_TRUE(set.insert(std::string("b")));
+    EXPECT_TRUE(set.contains("a"));
+    EXPECT_TRUE(set.contains(std::string_view("b"))); // transparent: no temporary string
+    EXPECT_FALSE(set.contains("c"));
+
+    for (int i = 0; i < 500; ++i) set.insert("key" + std::to_string(i));
+    EXPECT_EQ(set.size(), 502u);
+    EXPECT_TRUE(set.remove("a"));
+    EXPECT_FALSE(set.remove("a"));
+    EXPECT_FALSE(set.contains("a"));
+    EXPECT_EQ(set.stats().size, 501u);
+
+    set.clear();
+    EXPECT_EQ(set.size(), 0u);
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_FALSE(set.contains("b"));
+}
+
+TEST(HashSet, SplitLayout) {
+    HashSet<uint64_t, Hash<uint64_t>, std::equal_to<uint64_t>, LinearProbe, PowerOfTwoMask, SplitBuckets> set;
+    for (uint64_t i = 0; i < 10000; ++i) ASSERT_TRUE(set.insert(i * 7919));
+    for (uint64_t i = 0; i < 10000; i += 2) ASSERT_TRUE(set.remove(i * 7919));
+    EXPECT_EQ(set.size(), 5000u);
+    for (uint64_t i = 0; i < 10000; ++i) EXPECT_EQ(set.contains(i * 7919), i % 2 == 1) << i;
+}
+
+// ---------- Capacity Policies ----------
+
+TEST(CapacityPolicies, NormalizeAndGrow) {
+    EXPECT_EQ(PowerOfTwoMask::normalize(0), 1u);
+    EXPECT_EQ(PowerOfTwoMask::normalize(17), 32u);
+    EXPECT_EQ(FibonacciReduce::grow(32), 64u);
+    EXPECT_EQ(PrimeCapacity::normalize(16), 23u);
+    EXPECT_EQ(PrimeCapacity::grow(23), 47u);
+
+    EXPECT_EQ((LinearProbingHashTable<int, int>(100).capacity()), 128u);
+    EXPECT_EQ((DoubleHashingHashTable<int, int>(100).capacity()), 197u);
+}
+
+TEST(CapacityPolicies, ReduceStaysInRangeAndSpreads) {
+    for (size_t capacity : {1u, 2u, 64u, 1024u}) {
+        std::vector<int> hits(capacity, 0);
+        for (size_t h = 0; h < 4 * capacity; ++h) {
+            size_t masked = PowerOfTwoMask::reduce(h, capacity);
+            size_t fib = FibonacciReduce::reduce(h * 4096, capacity); // even weak strided hashes
+            ASSERT_LT(masked, capacity);
+            ASSERT_LT(fib, capacity);
+            ++hits[fib];
+        }
+        for (int count : hits) EXPECT_LE(count, 8); // no bucket takes more than twice its share
+    }
+    EXPECT_EQ(PrimeCapacity::reduce(100, 23), 100u % 23u);
+}
+
+// ---------- Heterogeneous Lookup and Emplacement ----------
+
+template <typename T>
+class EmplaceTest : public ::testing::Test {};
+TYPED_TEST_SUITE(EmplaceTest, ProbingTypes);
+
+TYPED_TEST(EmplaceTest, EmplaceTryEmplaceInsertOrAssign) {
+    TypeParam table;
+    auto [value, inserted] = table.tryEmplace("a", 1);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(*value, 1);
+    EXPECT_FALSE(table.tryEmplace("a", 2).second);
+    EXPECT_EQ(*table.find("a"), 1);
+
+    EXPECT_TRUE(table.emplace("b", 3).second);
+    EXPECT_FALSE(table.emplace("b", 4).second);
+    EXPECT_FALSE(table.insertOrAssign("a", 5));
+    EXPECT_TRUE(table.insertOrAssign(std::string("c"), 6));
+    EXPECT_TRUE(table.insert(std::string("d"), 7));
+
+    EXPECT_EQ(*table.find("a"), 5);
+    EXPECT_EQ(*table.find("b"), 3);
+    EXPECT_EQ(*table.find("c"), 6);
+    EXPECT_EQ(*table.find("d"), 7);
+    EXPECT_EQ(table.size(), 4u);
+}
+
+TEST(OpenAddressingHeterogeneous, StringViewLookupAndMoveOnlyValues) {
+    LinearProbingHashTable<std::string, std::unique_ptr<int>, Hash<std::string>, std::equal_to<>> table(4);
+    for (int i = 0; i < 100; ++i) {
+        std::string key = "key" + std::to_string(i);
+        ASSERT_TRUE(table.tryEmplace(std::string_view(key), std::make_unique<int>(i)).second);
+    }
+    for (int i = 0; i < 100; ++i) {
+        std::string key = "key" + std::to_string(i);
+        const std::unique_ptr<int>* v = table.find(std::string_view(key));
+        ASSERT_NE(v, nullptr);
+        EXPECT_EQ(**v, i);
+    }
+    auto pending = std::make_unique<int>(-1);
+    EXPECT_FALSE(table.tryEmplace("key5", std::move(pending)).second);
+    EXPECT_NE(pending, nullptr);
+
+    EXPECT_TRUE(table.remove(std::string_view("key5")));
+    EXPECT_EQ(table.find("key5"), nullptr);
+    EXPECT_EQ(table.size(), 99u);
+}
+
+// ---------- Batch Operations ----------
+
+template <typename T>
+class BatchTest : public ::testing::Test {};
+TYPED_TEST_SUITE(BatchTest, ProbingTypes);
+
+TYPED_TEST(BatchTest, FindBatchAndInsertBatch) {
+    for (bool incremental : {false, true}) {
+        TypeParam table(4, 0.5f, incremental);
+        std::vector<std::string> keys;
+        std::vector<int> values;
+        for (int i = 0; i < 1000; ++i) {
+            keys.push_back("key" + std::to_string(i));
+            values.push_back(i);
+        }
+        EXPECT_EQ(table.insertBatch(keys.data(), values.data(), 600), 600u);
+        EXPECT_EQ(table.insertBatch(keys.data() + 500, values.data() + 500, 500), 400u);
+        EXPECT_EQ(table.size(), 1000u);
+        for (int i = 0; i < 1000; i += 3) ASSERT_TRUE(table.remove(keys[i]));
+
+        keys.push_back("missing");
+        std::vector<int*> out(keys.size());
+        EXPECT_EQ(table.findBatch(keys.data(), keys.size(), out.data()), 1000u - 334u);
+        for (int i = 0; i < 1000; ++i) {
+            if (i % 3 == 0) {
+                EXPECT_EQ(out[i], nullptr);
+            } else {
+                ASSERT_NE(out[i], nullptr);
+                EXPECT_EQ(*out[i], i);
+            }
+        }
+        EXPECT_EQ(out.back(), nullptr);
+    }
+}
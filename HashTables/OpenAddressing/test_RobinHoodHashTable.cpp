@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+#include "RobinHoodHashTable.h"
+
+using namespace dsa;
+
+TEST(RobinHoodHashTable, UpdateHeavyWorkloadKeepsProbesShort) {
+    // A sliding window of live keys: with tombstones this would slowly fill
+    // the table with dead buckets; backward shifting leaves none.
+    RobinHoodHashTable<int, int> table(1024);
+    for (int i = 0; i < 800; ++i) table.insert(i, i);
+    for (int i = 800; i < 200000; ++i) {
+        ASSERT_TRUE(table.remove(i - 800));
+        ASSERT_TRUE(table.insert(i, i));
+    }
+    EXPECT_EQ(table.size(), 800u);
+    EXPECT_LT(table.maxProbeDistance(), 32u);
+    for (int i = 200000 - 800; i < 200000; ++i) ASSERT_NE(table.find(i), nullptr);
+}
+
+TEST(RobinHoodHashTable, ClearResetsProbeDistance) {
+    RobinHoodHashTable<int, int> table;
+    for (int i = 0; i < 100; ++i) table.insert(i, i);
+    table.clear();
+    EXPECT_EQ(table.maxProbeDistance(), 0u);
+}
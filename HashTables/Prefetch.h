@@ -0,0 +1,25 @@
+#pragma once
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+namespace dsa {
+    /**
+     * @brief Hints the CPU to start loading the cache line holding `p` for a read.
+     *
+     * Used by the tables' batch operations: issuing the loads for a group of
+     * keys before touching any of them lets their cache misses overlap. Only a
+     * hint, so a stale or out-of-range address is harmless; a no-op where the
+     * compiler offers no prefetch intrinsic.
+     */
+    inline void prefetchRead(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(p, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+        (void)p;
+#endif
+    }
+} // namespace dsa
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace dsa {
+    /**
+     * @brief The value type of the hash sets. Empty, and stored with
+     * [[no_unique_address]] by the tables, so a set's buckets hold keys only.
+     */
+    struct SetValue {};
+
+} // namespace dsa
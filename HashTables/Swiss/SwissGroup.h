@@ -0,0 +1,109 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(DSA_SWISS_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define DSA_SWISS_AVX2 1
+#elif !defined(DSA_SWISS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define DSA_SWISS_SSE2 1
+#endif
+
+namespace dsa {
+namespace swiss {
+    /**
+     * Control bytes. A full slot stores the low 7 bits of its hash (0..127);
+     * the two special states are negative, so "empty or deleted" is exactly
+     * "sign bit set".
+     */
+    using ctrl_t = int8_t;
+    constexpr ctrl_t kEmpty   = -128;   // 0b10000000
+    constexpr ctrl_t kDeleted = -2;     // 0b11111110
+
+    inline bool isFull(ctrl_t c) { return c >= 0; }
+
+    /// @brief A set of slot offsets within a group, one bit per slot.
+    class BitMask {
+    public:
+        explicit BitMask(uint32_t mask) : mask_(mask) {}
+
+        explicit operator bool() const { return mask_ != 0; }
+
+        /// @brief The lowest offset in the set. Requires a non-empty mask.
+        size_t lowest() const {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctz(mask_));
+#else
+            size_t bit = 0;
+            while (!((mask_ >> bit) & 1)) ++bit;
+            return bit;
+#endif
+        }
+
+        /// @brief Removes the lowest offset.
+        void clearLowest() { mask_ &= mask_ - 1; }
+
+    private:
+        uint32_t mask_;
+    };
+
+    /**
+     * @brief A view of kWidth consecutive control bytes, matched in parallel.
+     *
+     * With AVX2 a group is 32 bytes, with SSE2 16; each match is one compare
+     * plus a movemask. Elsewhere a 16-byte loop builds the same bitmask (and
+     * compilers typically vectorize it). Groups are always kWidth-aligned.
+     */
+    struct Group {
+#if defined(DSA_SWISS_AVX2)
+        static constexpr size_t kWidth = 32;
+
+        explicit Group(const ctrl_t* pos) : ctrl(_mm256_load_si256(reinterpret_cast<const __m256i*>(pos))) {}
+
+        BitMask match(ctrl_t h2) const {
+            return BitMask(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), ctrl))));
+        }
+        BitMask matchEmpty() const { return match(kEmpty); }
+        BitMask matchEmptyOrDeleted() const {
+            return BitMask(static_cast<uint32_t>(_mm256_movemask_epi8(ctrl)));
+        }
+
+        __m256i ctrl;
+#elif defined(DSA_SWISS_SSE2)
+        static constexpr size_t kWidth = 16;
+
+        explicit Group(const ctrl_t* pos) : ctrl(_mm_load_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+        BitMask match(ctrl_t h2) const {
+            return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))));
+        }
+        BitMask matchEmpty() const { return match(kEmpty); }
+        BitMask matchEmptyOrDeleted() const {
+            return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(ctrl)));
+        }
+
+        __m128i ctrl;
+#else
+        static constexpr size_t kWidth = 16;
+
+        explicit Group(const ctrl_t* pos) : ctrl(pos) {}
+
+        BitMask match(ctrl_t h2) const {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < kWidth; ++i) mask |= static_cast<uint32_t>(ctrl[i] == h2) << i;
+            return BitMask(mask);
+        }
+        BitMask matchEmpty() const { return match(kEmpty); }
+        BitMask matchEmptyOrDeleted() const {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < kWidth; ++i) mask |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+            return BitMask(mask);
+        }
+
+        const ctrl_t* ctrl;
+#endif
+    };
+
+} // namespace swiss
+} // namespace dsa
@@ -0,0 +1,126 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include "../Hash.h"
+#include "SwissGroup.h"
+
+namespace dsa {
+    /**
+     * @brief An open addressing hash map probed through 1-byte control tags.
+     *
+     * Unlike HashTableOpenAddressingBase, whose buckets interleave state with
+     * the key and value, this table keeps a separate array of control bytes:
+     * empty, deleted, or 7 bits of the key's hash (h2). Lookups probe whole
+     * groups of swiss::Group::kWidth tags at once, compare the key only where
+     * the tag matches, and stop at the first group holding an empty tag. A miss
+     * therefore usually costs one group load and no key comparisons, even at
+     * the 7/8 maximum load factor.
+     *
+     * The remaining hash bits (h1) pick the starting group; groups are then
+     * probed in triangular order, which covers the power-of-two group count.
+     * Both parts are taken straight from the hash, so Hash must mix every
+     * output bit, as dsa::Hash does.
+     *
+     * @tparam K The key type.
+     * @tparam V The value type.
+     * @tparam Hash The hash function object type.
+     * @tparam KeyEqual The key equality comparison object type.
+     */
+    template<
+        typename K,
+        typename V,
+        typename Hash     = Hash<K>,
+        typename KeyEqual = std::equal_to<K>
+    >
+    class SwissHashTable {
+    private:
+        using ctrl_t = swiss::ctrl_t;
+        static constexpr size_t kWidth = swiss::Group::kWidth;
+
+        /// @brief A stored key/value pair. Slots are raw storage until filled.
+        struct Entry {
+            K key;
+            V value;
+        };
+
+        ctrl_t*  ctrl_       = nullptr;  ///< capacity_ control bytes, kWidth-aligned
+        Entry*   slots_      = nullptr;  ///< capacity_ slots, constructed where ctrl is full
+        size_t   capacity_   = 0;        ///< power of two, multiple of kWidth
+        size_t   size_       = 0;        ///< number of live entries
+        size_t   growthLeft_ = 0;        ///< inserts into empty slots before a rehash
+        Hash     hasher_;
+        KeyEqual keyEqual_;
+
+    public:
+        /**
+         * @brief Constructs the hash table.
+         * @param capacity Initial number of slots; rounded up to a power of two
+         *        and at least one group.
+         */
+        explicit SwissHashTable(size_t capacity = 16);
+        ~SwissHashTable();
+
+        SwissHashTable(const SwissHashTable& other);
+        SwissHashTable(SwissHashTable&& other) noexcept;
+        SwissHashTable& operator=(SwissHashTable other) noexcept;
+
+        /// @brief Inserts a key/value pair. Returns false if key already exists.
+        bool insert(const K& key, const V& value);
+
+        /// @brief Removes a key.
+        /// @return false if key is not found.
+        bool remove(const K& key);
+
+        /// @brief Finds a key and returns a pointer to its value.
+        /// @return Pointer to the value, or nullptr if not found.
+        V* find(const K& key);
+        const V* find(const K& key) const;
+
+        /// @brief Checks if a key is present.
+        bool contains(const K& key) const;
+
+        /// @brief Returns the number of elements in the table.
+        size_t size() const;
+
+        /// @brief Checks if the table is empty.
+        bool isEmpty() const;
+
+        /// @brief Returns the number of slots.
+        size_t capacity() const;
+
+        /// @brief Grows the table so that n elements fit without rehashing.
+        void reserve(size_t n);
+
+        /// @brief Removes all elements, keeping the capacity.
+        void clear();
+
+        /// @brief Calls fn(key, value) for every element, in slot order.
+        template<typename Fn>
+        void forEach(Fn&& fn) const;
+
+        void swap(SwissHashTable& other) noexcept;
+
+    private:
+        static ctrl_t h2(size_t h) { return static_cast<ctrl_t>(h & 0x7F); }
+        static size_t h1(size_t h) { return h >> 7; }
+        /// @brief The number of slots that may be filled at a given capacity (7/8).
+        static size_t maxLoad(size_t capacity) { return capacity - capacity / 8; }
+
+        /// @brief Returns the slot holding key, or capacity_ if absent.
+        size_t findSlot(const K& key, size_t hash) const;
+        /// @brief Returns the first empty or deleted slot on the key's probe sequence.
+        size_t findInsertSlot(size_t hash) const;
+        /// @brief Moves every entry into fresh arrays of the given capacity.
+        void rehash(size_t newCapacity);
+        /// @brief Allocates empty arrays of the given capacity.
+        void allocate(size_t capacity);
+        /// @brief Destroys all entries and frees the arrays.
+        void release();
+    };
+
+} // namespace dsa
+
+#include "SwissHashTable.tpp"
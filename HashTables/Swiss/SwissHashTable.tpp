@@ -0,0 +1,259 @@
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace dsa {
+
+    // Construction & storage
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    SwissHashTable<K, V, Hash, KeyEqual>::SwissHashTable(size_t capacity) {
+        size_t cap = kWidth;
+        while (cap < capacity) cap *= 2;
+        allocate(cap);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    SwissHashTable<K, V, Hash, KeyEqual>::~SwissHashTable() {
+        release();
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    SwissHashTable<K, V, Hash, KeyEqual>::SwissHashTable(const SwissHashTable& other)
+        : hasher_(other.hasher_), keyEqual_(other.keyEqual_) {
+        if (!other.ctrl_) return; // moved-from: stay unallocated like other
+        allocate(other.capacity_);
+        // Same capacity and hash, so every entry keeps its slot.
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (!swiss::isFull(other.ctrl_[i])) continue;
+            new (&slots_[i]) Entry(other.slots_[i]);
+            ctrl_[i] = other.ctrl_[i];
+            ++size_;
+        }
+        growthLeft_ = other.growthLeft_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    SwissHashTable<K, V, Hash, KeyEqual>::SwissHashTable(SwissHashTable&& other) noexcept
+        : ctrl_(other.ctrl_), slots_(other.slots_), capacity_(other.capacity_),
+          size_(other.size_), growthLeft_(other.growthLeft_),
+          hasher_(std::move(other.hasher_)), keyEqual_(std::move(other.keyEqual_)) {
+        other.ctrl_ = nullptr;
+        other.slots_ = nullptr;
+        other.capacity_ = other.size_ = other.growthLeft_ = 0;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    SwissHashTable<K, V, Hash, KeyEqual>&
+    SwissHashTable<K, V, Hash, KeyEqual>::operator=(SwissHashTable other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void SwissHashTable<K, V, Hash, KeyEqual>::swap(SwissHashTable& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growthLeft_, other.growthLeft_);
+        std::swap(hasher_, other.hasher_);
+        std::swap(keyEqual_, other.keyEqual_);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void SwissHashTable<K, V, Hash, KeyEqual>::allocate(size_t capacity) {
+        ctrl_ = static_cast<ctrl_t*>(::operator new(capacity, std::align_val_t{kWidth}));
+        std::memset(ctrl_, static_cast<unsigned char>(swiss::kEmpty), capacity);
+        try {
+            slots_ = std::allocator<Entry>().allocate(capacity);
+        } catch (...) {
+            ::operator delete(ctrl_, std::align_val_t{kWidth});
+            ctrl_ = nullptr;
+            throw;
+        }
+        capacity_ = capacity;
+        size_ = 0;
+        growthLeft_ = maxLoad(capacity);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void SwissHashTable<K, V, Hash, KeyEqual>::release() {
+        if (!ctrl_) return;
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (swiss::isFull(ctrl_[i])) slots_[i].~Entry();
+        }
+        std::allocator<Entry>().deallocate(slots_, capacity_);
+        ::operator delete(ctrl_, std::align_val_t{kWidth});
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = size_ = growthLeft_ = 0;
+    }
+
+    // Hashing & probing
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t SwissHashTable<K, V, Hash, KeyEqual>::findSlot(const K& key, size_t hash) const {
+        if (!ctrl_) return capacity_; // moved-from
+        const size_t groupMask = capacity_ / kWidth - 1;
+        const ctrl_t tag = h2(hash);
+        size_t group = h1(hash) & groupMask;
+
+        for (size_t probes = 0; probes <= groupMask; ++probes) {
+            const size_t base = group * kWidth;
+            swiss::Group g(ctrl_ + base);
+            for (swiss::BitMask m = g.match(tag); m; m.clearLowest()) {
+                size_t slot = base + m.lowest();
+                if (keyEqual_(slots_[slot].key, key)) return slot;
+            }
+            if (g.matchEmpty()) break;
+            group = (group + probes + 1) & groupMask;
+        }
+        return capacity_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t SwissHashTable<K, V, Hash, KeyEqual>::findInsertSlot(size_t hash) const {
+        const size_t groupMask = capacity_ / kWidth - 1;
+        size_t group = h1(hash) & groupMask;
+
+        // The load factor keeps free slots around, so this always succeeds.
+        for (size_t probes = 0;; ++probes) {
+            const size_t base = group * kWidth;
+            swiss::BitMask m = swiss::Group(ctrl_ + base).matchEmptyOrDeleted();
+            if (m) return base + m.lowest();
+            group = (group + probes + 1) & groupMask;
+        }
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void SwissHashTable<K, V, Hash, KeyEqual>::rehash(size_t newCapacity) {
+        ctrl_t* oldCtrl = ctrl_;
+        Entry* oldSlots = slots_;
+        size_t oldCapacity = capacity_;
+
+        ctrl_ = nullptr;
+        try {
+            allocate(newCapacity);
+        } catch (...) {
+            ctrl_ = oldCtrl;
+            throw;
+        }
+
+        for (size_t i = 0; i < oldCapacity; ++i) {
+            if (!swiss::isFull(oldCtrl[i])) continue;
+            size_t hash = hasher_(oldSlots[i].key);
+            size_t slot = findInsertSlot(hash);
+            new (&slots_[slot]) Entry(std::move(oldSlots[i]));
+            ctrl_[slot] = h2(hash);
+            oldSlots[i].~Entry();
+            ++size_;
+            --growthLeft_;
+        }
+
+        std::allocator<Entry>().deallocate(oldSlots, oldCapacity);
+        ::operator delete(oldCtrl, std::align_val_t{kWidth});
+    }
+
+    // Core operations
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool SwissHashTable<K, V, Hash, KeyEqual>::insert(const K& key, const V& value) {
+        size_t hash = hasher_(key);
+        if (findSlot(key, hash) != capacity_) return false;
+        if (!ctrl_) allocate(kWidth); // moved-from
+
+        size_t slot = findInsertSlot(hash);
+        if (growthLeft_ == 0 && ctrl_[slot] == swiss::kEmpty) {
+            // Out of empty slots. If tombstones are most of the reason, rebuild
+            // in place; otherwise double.
+            size_t newCapacity = size_ * 2 <= maxLoad(capacity_) ? capacity_ : capacity_ * 2;
+            rehash(newCapacity);
+            slot = findInsertSlot(hash);
+        }
+
+        new (&slots_[slot]) Entry{key, value};
+        if (ctrl_[slot] == swiss::kEmpty) --growthLeft_;
+        ctrl_[slot] = h2(hash);
+        ++size_;
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool SwissHashTable<K, V, Hash, KeyEqual>::remove(const K& key) {
+        size_t slot = findSlot(key, hasher_(key));
+        if (slot == capacity_) return false;
+
+        slots_[slot].~Entry();
+        --size_;
+
+        // A group that still has an empty tag has never been probed past, so
+        // the slot can go back to empty instead of becoming a tombstone.
+        const size_t base = slot & ~(kWidth - 1);
+        if (swiss::Group(ctrl_ + base).matchEmpty()) {
+            ctrl_[slot] = swiss::kEmpty;
+            ++growthLeft_;
+        } else {
+            ctrl_[slot] = swiss::kDeleted;
+        }
+        return true;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    V* SwissHashTable<K, V, Hash, KeyEqual>::find(const K& key) {
+        size_t slot = findSlot(key, hasher_(key));
+        return slot == capacity_ ? nullptr : &slots_[slot].value;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    const V* SwissHashTable<K, V, Hash, KeyEqual>::find(const K& key) const {
+        size_t slot = findSlot(key, hasher_(key));
+        return slot == capacity_ ? nullptr : &slots_[slot].value;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool SwissHashTable<K, V, Hash, KeyEqual>::contains(const K& key) const {
+        return findSlot(key, hasher_(key)) != capacity_;
+    }
+
+    // Capacity & state
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t SwissHashTable<K, V, Hash, KeyEqual>::size() const {
+        return size_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    bool SwissHashTable<K, V, Hash, KeyEqual>::isEmpty() const {
+        return size_ == 0;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    size_t SwissHashTable<K, V, Hash, KeyEqual>::capacity() const {
+        return capacity_;
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void SwissHashTable<K, V, Hash, KeyEqual>::reserve(size_t n) {
+        if (!ctrl_) allocate(kWidth);
+        size_t cap = capacity_;
+        while (maxLoad(cap) < n) cap *= 2;
+        if (cap != capacity_) rehash(cap);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    void SwissHashTable<K, V, Hash, KeyEqual>::clear() {
+        if (!ctrl_) return;
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (swiss::isFull(ctrl_[i])) slots_[i].~Entry();
+        }
+        std::memset(ctrl_, static_cast<unsigned char>(swiss::kEmpty), capacity_);
+        size_ = 0;
+        growthLeft_ = maxLoad(capacity_);
+    }
+
+    template<typename K, typename V, typename Hash, typename KeyEqual>
+    template<typename Fn>
+    void SwissHashTable<K, V, Hash, KeyEqual>::forEach(Fn&& fn) const {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (swiss::isFull(ctrl_[i])) fn(slots_[i].key, slots_[i].value);
+        }
+    }
+
+} // namespace dsa
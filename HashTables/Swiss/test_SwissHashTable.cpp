@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include "SwissHashTable.h"
+
+using namespace dsa;
+
+TEST(SwissHashTable, InsertFindRemove) {
+    SwissHashTable<std::string, int> table;
+    EXPECT_TRUE(table.isEmpty());
+    EXPECT_TRUE(table.insert("apple", 3));
+    EXPECT_TRUE(table.insert("banana", 7));
+    EXPECT_FALSE(table.insert("apple", 99));
+
+    ASSERT_NE(table.find("apple"), nullptr);
+    EXPECT_EQ(*table.find("apple"), 3);
+    EXPECT_EQ(table.find("cherry"), nullptr);
+    EXPECT_EQ(table.size(), 2u);
+
+    EXPECT_TRUE(table.remove("apple"));
+    EXPECT_FALSE(table.remove("apple"));
+    EXPECT_FALSE(table.contains("apple"));
+    EXPECT_TRUE(table.contains("banana"));
+}
+
+TEST(SwissHashTable, GrowsAndKeepsEverything) {
+    SwissHashTable<int, int> table;
+    for (int i = 0; i < 10000; ++i) ASSERT_TRUE(table.insert(i, i * 2));
+    EXPECT_EQ(table.size(), 10000u);
+    EXPECT_GE(table.capacity() - table.capacity() / 8, 10000u);
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_NE(table.find(i), nullptr);
+        ASSERT_EQ(*table.find(i), i * 2);
+    }
+    EXPECT_EQ(table.find(10000), nullptr);
+    EXPECT_EQ(table.find(-1), nullptr);
+}
+
+TEST(SwissHashTable, ChurnDoesNotGrowWithoutBound) {
+    // Steady-state insert/remove must reuse tombstones or rebuild in place.
+    SwissHashTable<int, int> table(64);
+    for (int round = 0; round < 100000; ++round) {
+        ASSERT_TRUE(table.insert(round, round));
+        if (round >= 40) {
+            ASSERT_TRUE(table.remove(round - 40));
+        }
+    }
+    EXPECT_EQ(table.size(), 40u);
+    EXPECT_LE(table.capacity(), 128u);
+}
+
+TEST(SwissHashTable, MatchesUnorderedMap) {
+    std::mt19937 rng(3);
+    SwissHashTable<int, int> table;
+    std::unordered_map<int, int> ref;
+
+    for (int step = 0; step < 200000; ++step) {
+        int key = static_cast<int>(rng() % 5000);
+        switch (rng() % 3) {
+        case 0:
+            ASSERT_EQ(table.insert(key, step), ref.emplace(key, step).second);
+            break;
+        case 1:
+            ASSERT_EQ(table.remove(key), ref.erase(key) == 1);
+            break;
+        default: {
+            const int* v = table.find(key);
+            auto it = ref.find(key);
+            ASSERT_EQ(v != nullptr, it != ref.end());
+            if (v) {
+                ASSERT_EQ(*v, it->second);
+            }
+        }
+        }
+    }
+    ASSERT_EQ(table.size(), ref.size());
+
+    size_t visited = 0;
+    table.forEach([&](int k, int v) {
+        ++visited;
+        EXPECT_EQ(ref.at(k), v);
+    });
+    EXPECT_EQ(visited, ref.size());
+}
+
+TEST(SwissHashTable, CopyMoveAndClear) {
+    SwissHashTable<std::string, std::string> a;
+    for (int i = 0; i < 100; ++i) a.insert("k" + std::to_string(i), std::string(40, 'x'));
+
+    SwissHashTable<std::string, std::string> b(a);
+    EXPECT_EQ(b.size(), 100u);
+    EXPECT_TRUE(b.remove("k5"));
+    EXPECT_TRUE(a.contains("k5"));
+
+    SwissHashTable<std::string, std::string> c(std::move(a));
+    EXPECT_EQ(c.size(), 100u);
+    EXPECT_FALSE(a.contains("k5"));
+    EXPECT_TRUE(a.insert("again", "ok")); // moved-from is reusable
+
+    b = c;
+    EXPECT_TRUE(b.contains("k5"));
+    c.clear();
+    EXPECT_TRUE(c.isEmpty());
+    EXPECT_FALSE(c.contains("k1"));
+    EXPECT_TRUE(c.insert("k1", "y"));
+
+    // Copying a moved-from table gives a usable empty table.
+    SwissHashTable<std::string, std::string> d(std::move(c));
+    SwissHashTable<std::string, std::string> e(c);
+    EXPECT_EQ(e.find("k1"), nullptr);
+    EXPECT_TRUE(e.insert("k1", "z"));
+    b = c;
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_FALSE(b.contains("k5"));
+    EXPECT_TRUE(b.insert("k5", "w"));
+}
+
+TEST(SwissHashTable, DestroysValues) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        SwissHashTable<int, std::shared_ptr<int>> table;
+        for (int i = 0; i < 500; ++i) table.insert(i, tracker);
+        for (int i = 0; i < 250; ++i) table.remove(i);
+        EXPECT_EQ(tracker.use_count(), 251);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
@@ -0,0 +1,186 @@
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Hash.h"
+#include "Chaining/HashTableChaining.h"
+#include "OpenAddressing/LinearProbingHashTable.h"
+
+using namespace dsa;
+
+// Benchmark for dsa::Hash: throughput and bucket collisions, compared against
+// the identity / *31 polynomial hashes the tables used before, and for batched
+// versus one-at-a-time lookups in tables larger than the cache, and for the
+// inline versus split open addressing bucket layouts. Build with
+// -DCMAKE_BUILD_TYPE=Release for meaningful timings.
+
+namespace {
+    struct LegacyIntHash {
+        size_t operator()(int key) const { return static_cast<size_t>(key); }
+    };
+
+    struct LegacyStringHash {
+        size_t operator()(const std::string& key) const {
+            size_t hash = 0;
+            for (char c : key) hash = hash * 31 + static_cast<unsigned char>(c);
+            return hash;
+        }
+    };
+
+    // Keeps the optimizer from discarding the hashing work.
+    volatile size_t sink;
+
+    template<typename Hasher, typename Key>
+    double nanosPerHash(const std::vector<Key>& keys, int rounds) {
+        Hasher hasher;
+        size_t acc = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; ++r)
+            for (const Key& key : keys) acc += hasher(key);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        sink = acc;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (static_cast<double>(keys.size()) * rounds);
+    }
+
+    // Fraction of keys landing in an already occupied bucket of a power-of-two table.
+    template<typename Hasher, typename Key>
+    double collisionRate(const std::vector<Key>& keys, size_t buckets) {
+        Hasher hasher;
+        std::vector<bool> used(buckets, false);
+        size_t collisions = 0;
+        for (const Key& key : keys) {
+            size_t b = hasher(key) & (buckets - 1);
+            if (used[b]) ++collisions;
+            used[b] = true;
+        }
+        return static_cast<double>(collisions) / keys.size();
+    }
+
+    template<typename Legacy, typename Current, typename Key>
+    void report(const std::string& name, const std::vector<Key>& keys, int rounds, size_t buckets) {
+        std::cout << std::left << std::setw(26) << name << std::right << std::fixed
+                  << std::setprecision(2)
+                  << std::setw(10) << nanosPerHash<Legacy>(keys, rounds)
+                  << std::setw(10) << nanosPerHash<Current>(keys, rounds)
+                  << std::setprecision(3)
+                  << std::setw(12) << collisionRate<Legacy>(keys, buckets)
+                  << std::setw(12) << collisionRate<Current>(keys, buckets) << '\n';
+    }
+
+    std::vector<std::string> randomStrings(size_t count, size_t length, std::mt19937_64& rng) {
+        std::uniform_int_distribution<int> letter('a', 'z');
+        std::vector<std::string> out(count, std::string(length, ' '));
+        for (std::string& s : out)
+            for (char& c : s) c = static_cast<char>(letter(rng));
+        return out;
+    }
+
+    // Random lookups into a table far larger than L3: find() vs findBatch().
+    template<typename Table, typename FindOne>
+    void reportBatch(const std::string& name, Table& table, const std::vector<uint64_t>& probes, FindOne findOne) {
+        using Clock = std::chrono::steady_clock;
+        size_t hits = 0;
+
+        auto start = Clock::now();
+        for (uint64_t key : probes) hits += findOne(table, key) != nullptr;
+        double single = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / probes.size();
+
+        std::vector<uint64_t*> out(probes.size());
+        start = Clock::now();
+        hits += table.findBatch(probes.data(), probes.size(), out.data());
+        double batched = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / probes.size();
+
+        sink = hits;
+        std::cout << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << single << std::setw(10) << batched << '\n';
+    }
+
+    struct Payload {
+        uint64_t words[8];
+    };
+
+    // Hit and miss lookups into an int64 -> 64-byte table with the given bucket layout.
+    template<typename Layout>
+    void reportLayout(const std::string& name, const std::vector<uint64_t>& keys,
+                      const std::vector<uint64_t>& hits, const std::vector<uint64_t>& misses) {
+        using Clock = std::chrono::steady_clock;
+        LinearProbingHashTable<uint64_t, Payload, Hash<uint64_t>, std::equal_to<uint64_t>, PowerOfTwoMask, Layout> table;
+        for (uint64_t key : keys) table.insert(key, Payload{{key}});
+
+        uint64_t sum = 0;
+        auto start = Clock::now();
+        for (uint64_t key : hits) sum += table.find(key)->words[0];
+        double hitNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / hits.size();
+
+        start = Clock::now();
+        for (uint64_t key : misses) sum += table.find(key) != nullptr;
+        double missNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / misses.size();
+
+        sink = sum;
+        std::cout << std::left << std::setw(26) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << hitNs << std::setw(10) << missNs << '\n';
+    }
+}
+
+int main() {
+    constexpr size_t kKeys = 1 << 16;
+    constexpr size_t kBuckets = 1 << 17; // load factor 0.5
+    std::mt19937_64 rng(12345);
+
+    std::cout << std::left << std::setw(26) << "keys" << std::right
+              << std::setw(10) << "old ns" << std::setw(10) << "new ns"
+              << std::setw(12) << "old coll" << std::setw(12) << "new coll" << '\n';
+
+    std::vector<int> sequential(kKeys), strided(kKeys), random(kKeys);
+    for (size_t i = 0; i < kKeys; ++i) {
+        sequential[i] = static_cast<int>(i);
+        strided[i] = static_cast<int>(i * 4096);
+        random[i] = static_cast<int>(rng());
+    }
+    report<LegacyIntHash, Hash<int>>("int sequential", sequential, 200, kBuckets);
+    report<LegacyIntHash, Hash<int>>("int stride 4096", strided, 200, kBuckets);
+    report<LegacyIntHash, Hash<int>>("int random", random, 200, kBuckets);
+
+    for (size_t length : {4u, 8u, 16u, 32u, 64u, 256u, 1024u}) {
+        auto keys = randomStrings(length >= 256 ? kKeys / 16 : kKeys, length, rng);
+        int rounds = length >= 256 ? 20 : 50;
+        report<LegacyStringHash, Hash<std::string>>("string len " + std::to_string(length), keys, rounds, kBuckets);
+    }
+
+    // Short keys sharing a long prefix, like "user:000123".
+    std::vector<std::string> prefixed(kKeys);
+    for (size_t i = 0; i < kKeys; ++i) prefixed[i] = "user:" + std::to_string(1000000 + i);
+    report<LegacyStringHash, Hash<std::string>>("string shared prefix", prefixed, 50, kBuckets);
+
+    constexpr size_t kBigKeys = 1 << 21;
+    std::vector<uint64_t> bigKeys(kBigKeys), probes(kBigKeys);
+    for (uint64_t& key : bigKeys) key = rng();
+    for (uint64_t& key : probes) key = bigKeys[rng() % kBigKeys];
+
+    std::cout << '\n' << std::left << std::setw(26) << "lookups (2M keys)" << std::right
+              << std::setw(10) << "find ns" << std::setw(10) << "batch ns" << '\n';
+
+    LinearProbingHashTable<uint64_t, uint64_t> linear;
+    linear.insertBatch(bigKeys.data(), bigKeys.data(), kBigKeys);
+    reportBatch("linear probing", linear, probes,
+                [](auto& t, uint64_t key) { return t.find(key); });
+
+    HashTableChaining<uint64_t, uint64_t> chaining;
+    chaining.insertBatch(bigKeys.data(), bigKeys.data(), kBigKeys);
+    reportBatch("chaining", chaining, probes,
+                [](auto& t, uint64_t key) { return t.get(key); });
+
+    std::vector<uint64_t> layoutKeys(bigKeys.begin(), bigKeys.begin() + kBigKeys / 2);
+    std::vector<uint64_t> hitProbes(kBigKeys), missProbes(kBigKeys);
+    for (uint64_t& key : hitProbes) key = layoutKeys[rng() % layoutKeys.size()];
+    for (uint64_t& key : missProbes) key = rng();
+
+    std::cout << '\n' << std::left << std::setw(26) << "int64 -> 64B (1M keys)" << std::right
+              << std::setw(10) << "hit ns" << std::setw(10) << "miss ns" << '\n';
+    reportLayout<InlineBuckets>("inline buckets", layoutKeys, hitProbes, missProbes);
+    reportLayout<SplitBuckets>("split buckets", layoutKeys, hitProbes, missProbes);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include "Hash.h"
+
+using namespace dsa;
+
+TEST(Hash, IntegersAreMixedAcrossWidths) {
+    // -1 and 42 must agree regardless of the integer width they arrive in.
+    EXPECT_EQ(Hash<int>{}(-1), Hash<long long>{}(-1));
+    EXPECT_EQ(Hash<int16_t>{}(42), Hash<uint64_t>{}(42));
+    EXPECT_NE(Hash<int>{}(1), 1u); // no longer the identity
+    EXPECT_NE(Hash<int>{}(0), Hash<int>{}(1));
+
+    enum class Color : uint8_t { Red, Green };
+    EXPECT_EQ(Hash<Color>{}(Color::Green), Hash<uint8_t>{}(1));
+}
+
+TEST(Hash, StridedKeysSpreadOverPowerOfTwoBuckets) {
+    // Identity hashing maps every multiple of 1024 to bucket 0 of a 1024-bucket table.
+    constexpr size_t buckets = 1024;
+    std::unordered_set<size_t> used;
+    for (int i = 0; i < 1024; ++i) used.insert(Hash<int>{}(i * 1024) & (buckets - 1));
+    EXPECT_GT(used.size(), 600u); // a uniform hash fills ~632 of 1024
+}
+
+TEST(Hash, StringsMatchStringViewsAndCoverEveryLength) {
+    std::string text(200, 'x');
+    for (size_t i = 0; i < text.size(); ++i) text[i] = static_cast<char>('a' + i % 26);
+
+    std::unordered_set<size_t> seen;
+    for (size_t len = 0; len <= text.size(); ++len) {
+        std::string prefix = text.substr(0, len);
+        size_t h = Hash<std::string>{}(prefix);
+        EXPECT_EQ(h, Hash<std::string_view>{}(std::string_view(text).substr(0, len)));
+        seen.insert(h);
+    }
+    EXPECT_EQ(seen.size(), text.size() + 1); // every prefix length hashes differently
+
+    // A single changed byte anywhere changes the hash.
+    std::string flipped = text;
+    flipped[137] ^= 1;
+    EXPECT_NE(Hash<std::string>{}(flipped), Hash<std::string>{}(text));
+}
+
+TEST(Hash, PointersPairsAndTuples) {
+    int a = 0, b = 0;
+    EXPECT_EQ(Hash<int*>{}(&a), Hash<int*>{}(&a));
+    EXPECT_NE(Hash<int*>{}(&a), Hash<int*>{}(&b));
+
+    Hash<std::pair<int, int>> pairHash;
+    EXPECT_EQ(pairHash({1, 2}), pairHash({1, 2}));
+    EXPECT_NE(pairHash({1, 2}), pairHash({2, 1})); // order matters
+
+    Hash<std::tuple<int, std::string, char>> tupleHash;
+    EXPECT_EQ(tupleHash({1, "x", 'c'}), tupleHash({1, "x", 'c'}));
+    EXPECT_NE(tupleHash({1, "x", 'c'}), tupleHash({1, "y", 'c'}));
+}
@@ -11,7 +11,7 @@ namespace dsa {
 
     template<typename T>
     SinglyLinkedList<T>::SinglyLinkedList() {
-        dummy = new Node<T>(0);
+        dummy = new Node<T>(T());
         head = tail = nullptr;
     }
 
@@ -125,6 +125,8 @@ namespace dsa {
         while (curNode != nullptr) {
             if (curNode->data == d) {
                 prevNode->next = curNode->next;
+                if (curNode == tail) tail = (prevNode == dummy) ? nullptr : prevNode;
+                head = dummy->next;
                 delete curNode;
                 return;
             }
@@ -139,7 +141,8 @@ namespace dsa {
         if (isEmpty()) throw std::runtime_error("List is empty. Cannot remove front.");
         Node<T>* tempNode = dummy->next;
         dummy->next = tempNode->next;
-        if (!dummy->next) tail = nullptr;
+        head = dummy->next;
+        if (!head) tail = nullptr;
         delete tempNode;
     }
 
@@ -163,9 +166,10 @@ namespace dsa {
         Node<T>* tempNode = target->next;
         target->next = tempNode->next;
 
-        if (target == tail) {
-            tail = target;
+        if (tempNode == tail) {
+            tail = (target == dummy) ? nullptr : target;
         }
+        head = dummy->next;
         delete tempNode;
     }
 
@@ -178,7 +182,7 @@ namespace dsa {
             curNode = nextNode;
         }
         dummy->next = nullptr;
-        tail = dummy;
+        head = tail = nullptr;
     }
 
     template<typename T>
@@ -195,6 +199,7 @@ namespace dsa {
             curNode = nextNode;
         }
         dummy->next = prevNode;
+        head = prevNode;
     }
 
 } // namespace dsa
\ No newline at end of file
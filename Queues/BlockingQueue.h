@@ -0,0 +1,113 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "Queue.h"
+
+namespace dsa {
+    /**
+     * @brief A bounded, thread-safe FIFO queue with blocking and batch operations.
+     *
+     * This wraps a dsa::Queue with a mutex and two condition variables. Producers
+     * block while the queue is full (backpressure) and consumers block while it
+     * is empty. dequeueBatch() drains up to maxN items under a single lock
+     * acquisition, so per-item locking cost is amortized across the batch.
+     *
+     * close() starts a shutdown: further enqueues fail, blocked threads wake up,
+     * and consumers can still drain what is left before dequeue reports false.
+     *
+     * @tparam T The type of element stored.
+     */
+    template<typename T>
+    class BlockingQueue {
+    private:
+        Queue<T>                queue_;        // The underlying FIFO.
+        size_t                  count_ = 0;    // Tracked here; Queue::size() is O(n).
+        size_t                  capacity_;     // Maximum number of queued items.
+        bool                    closed_ = false;
+        mutable std::mutex      mutex_;
+        std::condition_variable notFull_;      // Signalled when space frees up.
+        std::condition_variable notEmpty_;     // Signalled when items arrive.
+
+        /// @brief Removes the front item into out. Caller holds the lock; queue non-empty.
+        void takeFront(T& out);
+
+    public:
+        /**
+         * @brief Constructs an empty queue.
+         * @param capacity The maximum number of queued items.
+         * @throws std::invalid_argument if capacity is 0.
+         */
+        explicit BlockingQueue(size_t capacity);
+
+        BlockingQueue(const BlockingQueue&) = delete;
+        BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+        /**
+         * @brief Adds an item, blocking while the queue is full.
+         * @return false if the queue is (or becomes) closed; the item is not added.
+         */
+        bool enqueue(const T& value);
+
+        /**
+         * @brief Adds an item, waiting at most `timeout` for space.
+         * @return false on timeout or if the queue is closed.
+         */
+        template<typename Rep, typename Period>
+        bool enqueue(const T& value, const std::chrono::duration<Rep, Period>& timeout);
+
+        /**
+         * @brief Adds an item only if there is space right now.
+         * @return false if the queue is full or closed.
+         */
+        bool tryEnqueue(const T& value);
+
+        /**
+         * @brief Removes the front item, blocking while the queue is empty.
+         * @param out Receives the item.
+         * @return false once the queue is closed and drained.
+         */
+        bool dequeue(T& out);
+
+        /**
+         * @brief Removes the front item only if one is available right now.
+         * @return false if the queue is empty.
+         */
+        bool tryDequeue(T& out);
+
+        /**
+         * @brief Waits up to `timeout` for items, then drains up to maxN of them
+         * under one lock acquisition. O(k) for k items drained.
+         * @param out Items are appended to this vector in FIFO order.
+         * @param maxN The maximum number of items to take.
+         * @return The number of items taken; 0 on timeout or once closed and drained.
+         */
+        template<typename Rep, typename Period>
+        size_t dequeueBatch(std::vector<T>& out, size_t maxN,
+                            const std::chrono::duration<Rep, Period>& timeout);
+
+        /**
+         * @brief Closes the queue and wakes every blocked producer and consumer.
+         * Items already queued can still be dequeued. Idempotent.
+         */
+        void close();
+
+        /// @brief Checks if close() has been called.
+        bool isClosed() const;
+
+        /// @brief Returns the number of queued items. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the queue is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Returns the capacity bound. O(1).
+        size_t capacity() const;
+    };
+
+} // namespace dsa
+
+#include "BlockingQueue.tpp"
@@ -0,0 +1,137 @@
+namespace dsa {
+
+    template<typename T>
+    BlockingQueue<T>::BlockingQueue(size_t capacity) : capacity_(capacity) {
+        if (capacity == 0) throw std::invalid_argument("BlockingQueue capacity must be positive.");
+    }
+
+    template<typename T>
+    void BlockingQueue<T>::takeFront(T& out) {
+        out = queue_.front();
+        queue_.dequeue();
+        --count_;
+    }
+
+    // Producers
+    template<typename T>
+    bool BlockingQueue<T>::enqueue(const T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this] { return closed_ || count_ < capacity_; });
+        if (closed_) return false;
+
+        queue_.enqueue(value);
+        ++count_;
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    template<typename T>
+    template<typename Rep, typename Period>
+    bool BlockingQueue<T>::enqueue(const T& value, const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!notFull_.wait_for(lock, timeout, [this] { return closed_ || count_ < capacity_; }))
+            return false;
+        if (closed_) return false;
+
+        queue_.enqueue(value);
+        ++count_;
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    template<typename T>
+    bool BlockingQueue<T>::tryEnqueue(const T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_ || count_ >= capacity_) return false;
+
+        queue_.enqueue(value);
+        ++count_;
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    // Consumers
+    template<typename T>
+    bool BlockingQueue<T>::dequeue(T& out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this] { return closed_ || count_ > 0; });
+        if (count_ == 0) return false; // closed and drained
+
+        takeFront(out);
+        lock.unlock();
+        notFull_.notify_one();
+        return true;
+    }
+
+    template<typename T>
+    bool BlockingQueue<T>::tryDequeue(T& out) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (count_ == 0) return false;
+
+        takeFront(out);
+        lock.unlock();
+        notFull_.notify_one();
+        return true;
+    }
+
+    template<typename T>
+    template<typename Rep, typename Period>
+    size_t BlockingQueue<T>::dequeueBatch(std::vector<T>& out, size_t maxN,
+                                          const std::chrono::duration<Rep, Period>& timeout) {
+        if (maxN == 0) return 0;
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait_for(lock, timeout, [this] { return closed_ || count_ > 0; });
+
+        size_t taken = 0;
+        while (taken < maxN && count_ > 0) {
+            out.push_back(queue_.front());
+            queue_.dequeue();
+            --count_;
+            ++taken;
+        }
+        lock.unlock();
+
+        // Several slots may have freed up at once.
+        if (taken == 1) notFull_.notify_one();
+        else if (taken > 1) notFull_.notify_all();
+        return taken;
+    }
+
+    template<typename T>
+    void BlockingQueue<T>::close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        notFull_.notify_all();
+        notEmpty_.notify_all();
+    }
+
+    // Accessors
+    template<typename T>
+    bool BlockingQueue<T>::isClosed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    template<typename T>
+    size_t BlockingQueue<T>::size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return count_;
+    }
+
+    template<typename T>
+    bool BlockingQueue<T>::isEmpty() const {
+        return size() == 0;
+    }
+
+    template<typename T>
+    size_t BlockingQueue<T>::capacity() const {
+        return capacity_;
+    }
+
+} // namespace dsa
@@ -0,0 +1,130 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief A monotone bucket queue (Dial's algorithm) over non-negative integer keys.
+     *
+     * Keys index directly into a circular array of buckets, one key value per
+     * bucket, so push and decreaseKey are O(1) and finding the minimum is a walk
+     * forward from the last minimum. This is the fastest option when the spread
+     * of live keys is small, e.g. Dijkstra with small integer edge weights, where
+     * the live keys always fit in [d, d + maxWeight].
+     *
+     * The window grows (doubling, with a redistribution) whenever a key lands
+     * further than the current bucket count from the minimum, so no maximum
+     * weight has to be known up front.
+     *
+     * As with dsa::RadixHeap, every pushed or decreased key must be at least the
+     * last key seen through top(), topKey() or pop(). The interface matches
+     * dsa::IndexedPriorityQueue so the queues are interchangeable in dsa::dijkstra.
+     *
+     * @tparam Key An integral key type. Negative keys are rejected.
+     */
+    template<typename Key = unsigned int>
+    class BucketQueue {
+        static_assert(std::is_integral_v<Key>, "BucketQueue keys must be integral.");
+
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        /**
+         * @brief Where an id lives: its bucket and its index within the bucket.
+         */
+        struct Location {
+            size_t bucket = npos;
+            size_t slot   = 0;
+        };
+
+        std::vector<std::vector<size_t>> buckets_;  // Circular; size is a power of two.
+        std::vector<Location> where_;               // where_[id], bucket == npos if absent.
+        std::vector<uint64_t> keys_;                // keys_[id]
+        mutable uint64_t last_ = 0;                 // Last key seen through top(): the monotone bound.
+        mutable uint64_t base_ = 0;                 // Window start; <= every live key.
+        uint64_t maxKey_ = 0;                       // >= every live key.
+        size_t mask_;                               // buckets_.size() - 1
+        size_t size_ = 0;
+
+        void link(size_t id);
+        void unlink(size_t id);
+        /// @brief Widens the window so it covers key, growing and redistributing if needed.
+        void fit(uint64_t key);
+        /// @brief Moves base_ forward to the first non-empty bucket and records it as the bound.
+        void advance() const;
+        /// @brief Converts and validates a key against the monotone bound.
+        uint64_t checkedKey(const Key& key) const;
+
+    public:
+        /**
+         * @brief Constructs an empty bucket queue.
+         * @param capacity The expected id range [0, capacity). Larger ids grow the tables.
+         * @param initialBuckets Initial key window, rounded up to a power of two. Passing
+         *        maxWeight + 1 avoids any growth in Dijkstra.
+         */
+        explicit BucketQueue(size_t capacity = 0, size_t initialBuckets = 64);
+
+        /**
+         * @brief Inserts an id with the given key. O(1) amortized.
+         * @throws std::invalid_argument if the id is present or the key is below the last top key.
+         */
+        void push(size_t id, const Key& key);
+
+        /**
+         * @brief Lowers an id's key. O(1).
+         * @throws std::invalid_argument if the id is absent, the key grows, or it breaks monotonicity.
+         */
+        void decreaseKey(size_t id, const Key& key);
+
+        /**
+         * @brief Removes an id from the queue. O(1).
+         * @return false if the id was not present.
+         */
+        bool erase(size_t id);
+
+        /**
+         * @brief Removes the top entry. O(1) plus the walk to the next non-empty bucket.
+         * @throws std::runtime_error if the queue is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns an id with the smallest key. O(1) plus the bucket walk.
+         * @throws std::runtime_error if the queue is empty.
+         */
+        size_t top() const;
+
+        /**
+         * @brief Returns the smallest key. O(1) plus the bucket walk.
+         * @throws std::runtime_error if the queue is empty.
+         */
+        Key topKey() const;
+
+        /**
+         * @brief Returns the current key of an id. O(1).
+         * @throws std::invalid_argument if the id is absent.
+         */
+        Key keyOf(size_t id) const;
+
+        /// @brief Checks whether an id is currently in the queue. O(1).
+        bool contains(size_t id) const;
+
+        /// @brief Returns the number of entries. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the queue is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Returns the current key window (number of buckets). O(1).
+        size_t bucketCount() const;
+
+        /// @brief Removes all entries and resets the monotone bound to 0. O(n).
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "BucketQueue.tpp"
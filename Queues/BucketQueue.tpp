@@ -0,0 +1,166 @@
+namespace dsa {
+
+    template<typename Key>
+    BucketQueue<Key>::BucketQueue(size_t capacity, size_t initialBuckets)
+        : where_(capacity), keys_(capacity, 0) {
+        size_t n = 1;
+        while (n < initialBuckets) n <<= 1;
+        buckets_.resize(n);
+        mask_ = n - 1;
+    }
+
+    // Helpers
+    template<typename Key>
+    void BucketQueue<Key>::link(size_t id) {
+        size_t b = static_cast<size_t>(keys_[id]) & mask_;
+        where_[id] = Location{b, buckets_[b].size()};
+        buckets_[b].push_back(id);
+    }
+
+    template<typename Key>
+    void BucketQueue<Key>::unlink(size_t id) {
+        // Swap-remove: move the bucket's last id into the vacated slot.
+        Location loc = where_[id];
+        std::vector<size_t>& bucket = buckets_[loc.bucket];
+        size_t moved = bucket.back();
+        bucket[loc.slot] = moved;
+        where_[moved].slot = loc.slot;
+        bucket.pop_back();
+        where_[id].bucket = npos;
+    }
+
+    template<typename Key>
+    void BucketQueue<Key>::fit(uint64_t key) {
+        if (size_ == 0) {
+            base_ = maxKey_ = key;  // Empty: the window can move anywhere above the bound.
+            return;
+        }
+
+        uint64_t low  = key < base_ ? key : base_;
+        uint64_t high = key > maxKey_ ? key : maxKey_;
+        base_ = low;
+        maxKey_ = high;
+        if (high - low <= mask_) return;
+
+        // Buckets are indexed by key & mask, so a wider window means relinking everyone.
+        size_t n = buckets_.size();
+        while (high - low >= n) n <<= 1;
+
+        std::vector<std::vector<size_t>> old(n);
+        old.swap(buckets_);
+        mask_ = n - 1;
+        for (const auto& bucket : old) {
+            for (size_t id : bucket) link(id);
+        }
+    }
+
+    template<typename Key>
+    void BucketQueue<Key>::advance() const {
+        while (buckets_[static_cast<size_t>(base_) & mask_].empty()) ++base_;
+        last_ = base_;
+    }
+
+    template<typename Key>
+    uint64_t BucketQueue<Key>::checkedKey(const Key& key) const {
+        if constexpr (std::is_signed_v<Key>) {
+            if (key < 0) throw std::invalid_argument("BucketQueue keys must be non-negative.");
+        }
+        uint64_t k = static_cast<uint64_t>(key);
+        if (k < last_) throw std::invalid_argument("BucketQueue key is below the last extracted key.");
+        return k;
+    }
+
+    // Core operations
+    template<typename Key>
+    void BucketQueue<Key>::push(size_t id, const Key& key) {
+        if (contains(id)) throw std::invalid_argument("Id is already in the bucket queue.");
+        uint64_t k = checkedKey(key);
+        if (id >= where_.size()) {
+            where_.resize(id + 1);
+            keys_.resize(id + 1, 0);
+        }
+        fit(k);
+
+        keys_[id] = k;
+        link(id);
+        ++size_;
+    }
+
+    template<typename Key>
+    void BucketQueue<Key>::decreaseKey(size_t id, const Key& key) {
+        if (!contains(id)) throw std::invalid_argument("Id is not in the bucket queue.");
+        uint64_t k = checkedKey(key);
+        if (k > keys_[id]) throw std::invalid_argument("decreaseKey: new key is larger than the current key.");
+
+        unlink(id);
+        keys_[id] = k;
+        fit(k);
+        link(id);
+    }
+
+    template<typename Key>
+    bool BucketQueue<Key>::erase(size_t id) {
+        if (!contains(id)) return false;
+        unlink(id);
+        --size_;
+        return true;
+    }
+
+    template<typename Key>
+    void BucketQueue<Key>::pop() {
+        if (size_ == 0) throw std::runtime_error("BucketQueue is empty. Cannot pop.");
+        erase(top());
+    }
+
+    // Accessors
+    template<typename Key>
+    size_t BucketQueue<Key>::top() const {
+        if (size_ == 0) throw std::runtime_error("BucketQueue is empty. No top element.");
+        advance();
+        return buckets_[static_cast<size_t>(base_) & mask_].back();
+    }
+
+    template<typename Key>
+    Key BucketQueue<Key>::topKey() const {
+        if (size_ == 0) throw std::runtime_error("BucketQueue is empty. No top element.");
+        advance();
+        return static_cast<Key>(base_);
+    }
+
+    template<typename Key>
+    Key BucketQueue<Key>::keyOf(size_t id) const {
+        if (!contains(id)) throw std::invalid_argument("Id is not in the bucket queue.");
+        return static_cast<Key>(keys_[id]);
+    }
+
+    template<typename Key>
+    bool BucketQueue<Key>::contains(size_t id) const {
+        return id < where_.size() && where_[id].bucket != npos;
+    }
+
+    template<typename Key>
+    size_t BucketQueue<Key>::size() const {
+        return size_;
+    }
+
+    template<typename Key>
+    bool BucketQueue<Key>::isEmpty() const {
+        return size_ == 0;
+    }
+
+    template<typename Key>
+    size_t BucketQueue<Key>::bucketCount() const {
+        return buckets_.size();
+    }
+
+    template<typename Key>
+    void BucketQueue<Key>::clear() {
+        for (auto& bucket : buckets_) {
+            for (size_t id : bucket) where_[id].bucket = npos;
+            bucket.clear();
+        }
+        size_ = 0;
+        last_ = base_ = maxKey_ = 0;
+    }
+
+} // namespace dsa
@@ -0,0 +1,147 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "Executor.h"
+#include "Queue.h"
+
+namespace dsa {
+    /**
+     * @brief A bounded channel whose send and receive are awaited by coroutines.
+     *
+     * This is the coroutine counterpart of dsa::BlockingQueue. Items wait in a
+     * dsa::Queue up to `capacity`. A sender that finds it full, or a receiver
+     * that finds it empty, suspends: its awaiter (which lives in the coroutine
+     * frame) is linked into an intrusive FIFO of waiters, so no OS thread
+     * blocks and waiting allocates nothing. The operation that unblocks a
+     * waiter completes the handoff under the lock and hands the waiter's
+     * coroutine to the executor.
+     *
+     * A capacity of 0 gives a rendezvous channel: every send waits for a
+     * receiver. close() fails pending and future sends; receivers drain what
+     * is buffered and then get std::nullopt.
+     *
+     * Operations are guarded by a mutex, so a channel may be shared between
+     * coroutines on a ThreadPoolExecutor.
+     *
+     * @tparam T The type of element sent. Must be copyable, like dsa::Queue.
+     */
+    template<typename T>
+    class Channel {
+    public:
+        class SendAwaiter;
+        class ReceiveAwaiter;
+
+        /**
+         * @brief Constructs an open, empty channel.
+         * @param executor Where suspended senders and receivers are resumed.
+         * @param capacity The number of items buffered before senders suspend.
+         */
+        explicit Channel(Executor& executor, size_t capacity = 0);
+
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        /**
+         * @brief `co_await ch.send(v)` delivers v, suspending while the channel is full.
+         * The expression yields false if the channel is closed; v is then discarded.
+         */
+        SendAwaiter send(T value);
+
+        /**
+         * @brief `co_await ch.receive()` takes the oldest item, suspending while none is available.
+         * The expression yields std::nullopt once the channel is closed and drained.
+         */
+        ReceiveAwaiter receive();
+
+        /**
+         * @brief Sends without suspending; usable outside coroutines.
+         * @return false if the channel is full or closed.
+         */
+        bool trySend(const T& value);
+
+        /**
+         * @brief Receives without suspending; usable outside coroutines.
+         * @return std::nullopt if nothing is available.
+         */
+        std::optional<T> tryReceive();
+
+        /// @brief Closes the channel and resumes every waiter. Idempotent.
+        void close();
+
+        /// @brief Checks if close() has been called.
+        bool isClosed() const;
+
+        /// @brief Returns the number of buffered items. O(1).
+        size_t size() const;
+
+        /// @brief Returns the buffer capacity. O(1).
+        size_t capacity() const;
+
+        class SendAwaiter {
+        public:
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> handle);
+            bool await_resume() const noexcept { return ok_; }
+
+        private:
+            friend class Channel;
+            SendAwaiter(Channel& channel, T value) : channel_(channel), value_(std::move(value)) {}
+
+            Channel&                channel_;
+            T                       value_;
+            std::coroutine_handle<> handle_;
+            SendAwaiter*            next_ = nullptr;
+            bool                    ok_ = false;
+        };
+
+        class ReceiveAwaiter {
+        public:
+            bool await_ready() const noexcept { return false; }
+            bool await_suspend(std::coroutine_handle<> handle);
+            std::optional<T> await_resume() { return std::move(result_); }
+
+        private:
+            friend class Channel;
+            explicit ReceiveAwaiter(Channel& channel) : channel_(channel) {}
+
+            Channel&                channel_;
+            std::optional<T>        result_;
+            std::coroutine_handle<> handle_;
+            ReceiveAwaiter*         next_ = nullptr;
+        };
+
+    private:
+        /// @brief An intrusive FIFO of suspended awaiters, linked through next_.
+        template<typename Awaiter>
+        struct WaitList {
+            Awaiter* head = nullptr;
+            Awaiter* tail = nullptr;
+
+            bool isEmpty() const { return head == nullptr; }
+            void push(Awaiter* a);
+            Awaiter* pop();
+        };
+
+        Executor&                  executor_;
+        Queue<T>                   buffer_;
+        size_t                     count_ = 0;    // Tracked here; Queue::size() is O(n).
+        size_t                     capacity_;
+        bool                       closed_ = false;
+        mutable std::mutex         mutex_;
+        WaitList<SendAwaiter>      senders_;      // Suspended because the buffer is full.
+        WaitList<ReceiveAwaiter>   receivers_;    // Suspended because nothing is available.
+
+        /// @brief Delivers to a waiting receiver or buffers. Caller holds the lock.
+        /// @return The receiver to resume, or nullptr.
+        ReceiveAwaiter* deliver(T&& value);
+        /// @brief Takes the oldest item, refilling from a waiting sender. Caller holds the lock.
+        /// @return The sender to resume, or nullptr.
+        SendAwaiter* take(std::optional<T>& out);
+    };
+
+} // namespace dsa
+
+#include "Channel.tpp"
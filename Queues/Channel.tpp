@@ -0,0 +1,170 @@
+namespace dsa {
+
+    template<typename T>
+    Channel<T>::Channel(Executor& executor, size_t capacity) : executor_(executor), capacity_(capacity) {}
+
+    // Wait lists
+    template<typename T>
+    template<typename Awaiter>
+    void Channel<T>::WaitList<Awaiter>::push(Awaiter* a) {
+        a->next_ = nullptr;
+        if (tail) tail->next_ = a;
+        else head = a;
+        tail = a;
+    }
+
+    template<typename T>
+    template<typename Awaiter>
+    Awaiter* Channel<T>::WaitList<Awaiter>::pop() {
+        Awaiter* a = head;
+        head = a->next_;
+        if (!head) tail = nullptr;
+        return a;
+    }
+
+    // Handoff helpers
+    template<typename T>
+    typename Channel<T>::ReceiveAwaiter* Channel<T>::deliver(T&& value) {
+        if (!receivers_.isEmpty()) {
+            // Only possible while the buffer is empty.
+            ReceiveAwaiter* receiver = receivers_.pop();
+            receiver->result_.emplace(std::move(value));
+            return receiver;
+        }
+        buffer_.enqueue(value);
+        ++count_;
+        return nullptr;
+    }
+
+    template<typename T>
+    typename Channel<T>::SendAwaiter* Channel<T>::take(std::optional<T>& out) {
+        if (count_ > 0) {
+            out.emplace(buffer_.front());
+            buffer_.dequeue();
+            --count_;
+            if (senders_.isEmpty()) return nullptr;
+
+            // A slot just opened up; the oldest waiting sender fills it.
+            SendAwaiter* sender = senders_.pop();
+            buffer_.enqueue(sender->value_);
+            ++count_;
+            sender->ok_ = true;
+            return sender;
+        }
+        if (!senders_.isEmpty()) {
+            // Rendezvous: take straight from the sender.
+            SendAwaiter* sender = senders_.pop();
+            out.emplace(std::move(sender->value_));
+            sender->ok_ = true;
+            return sender;
+        }
+        return nullptr;
+    }
+
+    // Awaitable operations
+    template<typename T>
+    typename Channel<T>::SendAwaiter Channel<T>::send(T value) {
+        return SendAwaiter(*this, std::move(value));
+    }
+
+    template<typename T>
+    typename Channel<T>::ReceiveAwaiter Channel<T>::receive() {
+        return ReceiveAwaiter(*this);
+    }
+
+    template<typename T>
+    bool Channel<T>::SendAwaiter::await_suspend(std::coroutine_handle<> handle) {
+        std::unique_lock<std::mutex> lock(channel_.mutex_);
+        if (channel_.closed_) return false; // ok_ stays false
+
+        if (!channel_.receivers_.isEmpty() || channel_.count_ < channel_.capacity_) {
+            ReceiveAwaiter* receiver = channel_.deliver(std::move(value_));
+            ok_ = true;
+            lock.unlock();
+            if (receiver) channel_.executor_.schedule(receiver->handle_);
+            return false;
+        }
+
+        // Once linked in, another thread may resume us as soon as the lock is
+        // released, so nothing here may touch *this afterwards.
+        handle_ = handle;
+        channel_.senders_.push(this);
+        return true;
+    }
+
+    template<typename T>
+    bool Channel<T>::ReceiveAwaiter::await_suspend(std::coroutine_handle<> handle) {
+        std::unique_lock<std::mutex> lock(channel_.mutex_);
+        if (channel_.count_ > 0 || !channel_.senders_.isEmpty()) {
+            SendAwaiter* sender = channel_.take(result_);
+            Executor& executor = channel_.executor_;
+            lock.unlock();
+            if (sender) executor.schedule(sender->handle_);
+            return false;
+        }
+        if (channel_.closed_) return false; // result_ stays empty
+
+        handle_ = handle;
+        channel_.receivers_.push(this);
+        return true;
+    }
+
+    // Non-suspending operations
+    template<typename T>
+    bool Channel<T>::trySend(const T& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (closed_) return false;
+        if (receivers_.isEmpty() && count_ >= capacity_) return false;
+
+        ReceiveAwaiter* receiver = deliver(T(value));
+        lock.unlock();
+        if (receiver) executor_.schedule(receiver->handle_);
+        return true;
+    }
+
+    template<typename T>
+    std::optional<T> Channel<T>::tryReceive() {
+        std::optional<T> out;
+        std::unique_lock<std::mutex> lock(mutex_);
+        SendAwaiter* sender = take(out);
+        lock.unlock();
+        if (sender) executor_.schedule(sender->handle_);
+        return out;
+    }
+
+    template<typename T>
+    void Channel<T>::close() {
+        WaitList<SendAwaiter> senders;
+        WaitList<ReceiveAwaiter> receivers;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) return;
+            closed_ = true;
+            std::swap(senders, senders_);
+            std::swap(receivers, receivers_);
+        }
+        // Waiting receivers imply an empty buffer, so they all get std::nullopt;
+        // waiting senders are refused.
+        while (!senders.isEmpty()) executor_.schedule(senders.pop()->handle_);
+        while (!receivers.isEmpty()) executor_.schedule(receivers.pop()->handle_);
+    }
+
+    // Accessors
+    template<typename T>
+    bool Channel<T>::isClosed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    template<typename T>
+    size_t Channel<T>::size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return count_;
+    }
+
+    template<typename T>
+    size_t Channel<T>::capacity() const {
+        return capacity_;
+    }
+
+} // namespace dsa
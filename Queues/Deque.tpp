@@ -13,7 +13,7 @@ namespace dsa {
     T Deque<T>::popFront() {
         if (list.isEmpty()) throw std::runtime_error("Deque is empty. Cannot pop front.");
         T value = list.front();
-        list.remove(value);
+        list.removeAfter(list.getHead()->prev);
         return value;
     }
 
@@ -21,7 +21,8 @@ namespace dsa {
     T Deque<T>::popBack() {
         if (list.isEmpty()) throw std::runtime_error("Deque is empty. Cannot pop back.");
         T value = list.back();
-        list.remove(value);
+        // Unlink the tail node itself; remove(value) would drop the first equal element.
+        list.removeAfter(list.getTail()->prev);
         return value;
     }
 
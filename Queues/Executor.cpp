@@ -0,0 +1,74 @@
+#include "Executor.h"
+#include <utility>
+
+namespace dsa {
+
+    // AsyncTask
+    void AsyncTask::promise_type::unhandled_exception() {
+        if (executor) executor->reportError(std::current_exception());
+    }
+
+    AsyncTask::AsyncTask(AsyncTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    AsyncTask::~AsyncTask() {
+        if (handle_) handle_.destroy();
+    }
+
+    // Executor
+    void Executor::spawn(AsyncTask task) {
+        auto handle = std::exchange(task.handle_, nullptr);
+        handle.promise().executor = this;
+        schedule(handle);
+    }
+
+    void Executor::reportError(std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        if (!firstError_) firstError_ = error;
+    }
+
+    void Executor::rethrowError() {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            error = std::exchange(firstError_, nullptr);
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    // SingleThreadExecutor
+    SingleThreadExecutor::~SingleThreadExecutor() {
+        while (!ready_.isEmpty()) {
+            ready_.front().destroy();
+            ready_.dequeue();
+        }
+    }
+
+    void SingleThreadExecutor::schedule(std::coroutine_handle<> handle) {
+        ready_.enqueue(handle);
+    }
+
+    size_t SingleThreadExecutor::run() {
+        size_t resumed = 0;
+        while (!ready_.isEmpty()) {
+            std::coroutine_handle<> handle = ready_.front();
+            ready_.dequeue();
+            handle.resume();
+            ++resumed;
+        }
+        rethrowError();
+        return resumed;
+    }
+
+    // ThreadPoolExecutor
+    ThreadPoolExecutor::ThreadPoolExecutor(size_t numThreads) : pool_(numThreads) {}
+
+    void ThreadPoolExecutor::schedule(std::coroutine_handle<> handle) {
+        pool_.submit([handle] { handle.resume(); });
+    }
+
+    void ThreadPoolExecutor::wait() {
+        pool_.wait();
+        rethrowError();
+    }
+
+} // namespace dsa
@@ -0,0 +1,127 @@
+#pragma once
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include "Queue.h"
+#include "ThreadPool.h"
+
+namespace dsa {
+    class Executor;
+
+    /**
+     * @brief A fire-and-forget coroutine, started with Executor::spawn().
+     *
+     * Any function returning AsyncTask may co_await dsa::Channel operations.
+     * The coroutine does not run until it is spawned, and its frame frees
+     * itself when the body finishes. An exception escaping the body is handed
+     * to the executor, which rethrows the first one from run() or wait().
+     */
+    class AsyncTask {
+    public:
+        struct promise_type {
+            Executor* executor = nullptr;
+
+            AsyncTask get_return_object() {
+                return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception();
+        };
+
+        AsyncTask(AsyncTask&& other) noexcept;
+        AsyncTask& operator=(AsyncTask&&) = delete;
+        /// @brief Destroys the coroutine if it was never spawned.
+        ~AsyncTask();
+
+    private:
+        friend class Executor;
+        explicit AsyncTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    /**
+     * @brief Somewhere to resume suspended coroutines.
+     *
+     * dsa::Channel never resumes a waiting coroutine inline; it passes the
+     * handle to schedule(), so a send or receive never runs another
+     * coroutine's code on the caller's stack.
+     */
+    class Executor {
+    public:
+        virtual ~Executor() = default;
+
+        /// @brief Queues a suspended coroutine to be resumed.
+        virtual void schedule(std::coroutine_handle<> handle) = 0;
+
+        /// @brief Starts a coroutine on this executor.
+        void spawn(AsyncTask task);
+
+        /// @brief Records an exception that escaped a spawned coroutine; keeps the first.
+        void reportError(std::exception_ptr error);
+
+    protected:
+        /// @brief Rethrows (and clears) the first reported exception, if any.
+        void rethrowError();
+
+    private:
+        std::mutex         errorMutex_;
+        std::exception_ptr firstError_;
+    };
+
+    /**
+     * @brief Runs coroutines one at a time on the thread that calls run().
+     *
+     * Ready coroutines wait in a dsa::Queue. Thousands of logical streams can
+     * interleave on one OS thread, each suspending at its channel operations.
+     * Not thread-safe: schedule and run from one thread only.
+     */
+    class SingleThreadExecutor : public Executor {
+    public:
+        SingleThreadExecutor() = default;
+        /// @brief Destroys coroutines that were scheduled but never resumed.
+        ~SingleThreadExecutor() override;
+
+        SingleThreadExecutor(const SingleThreadExecutor&) = delete;
+        SingleThreadExecutor& operator=(const SingleThreadExecutor&) = delete;
+
+        void schedule(std::coroutine_handle<> handle) override;
+
+        /**
+         * @brief Resumes ready coroutines until none are left.
+         * Coroutines still blocked on a channel stay suspended.
+         * @return The number of resumptions performed.
+         */
+        size_t run();
+
+    private:
+        Queue<std::coroutine_handle<>> ready_;
+    };
+
+    /**
+     * @brief Resumes coroutines on a dsa::ThreadPool.
+     *
+     * Each resumption is one pool task, so a coroutine may continue on a
+     * different worker after every suspension. Channels are safe to share
+     * between coroutines on this executor.
+     */
+    class ThreadPoolExecutor : public Executor {
+    public:
+        /// @brief Starts the pool. 0 threads means hardware_concurrency().
+        explicit ThreadPoolExecutor(size_t numThreads = 0);
+
+        void schedule(std::coroutine_handle<> handle) override;
+
+        /**
+         * @brief Blocks until no coroutine is ready to run.
+         * @throws The first exception that escaped a coroutine.
+         */
+        void wait();
+
+    private:
+        ThreadPool pool_;
+    };
+
+} // namespace dsa
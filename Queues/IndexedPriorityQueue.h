@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief An indexed d-ary heap supporting decreaseKey and erase by handle.
+     *
+     * Every element is identified by an integer handle (id) chosen by the caller,
+     * typically a vertex index in [0, capacity). A position table maps each id to
+     * its slot in the heap, so an element's key can be changed or the element can
+     * be removed in O(log n) without searching. Keys are stored inline with their
+     * ids in the heap array to keep sifting cache friendly.
+     *
+     * Unlike a lazy-deletion std::priority_queue, each id appears at most once,
+     * so the heap never holds more than `capacity` entries.
+     *
+     * @tparam Key The priority key type.
+     * @tparam Compare Comparison functor; Compare(a, b) is true if a has priority over b.
+     * @tparam Arity The number of children per node.
+     */
+    template<typename Key, typename Compare = std::less<Key>, size_t Arity = 4>
+    class IndexedPriorityQueue {
+        static_assert(Arity >= 2, "IndexedPriorityQueue arity must be at least 2.");
+
+    private:
+        /**
+         * @brief A heap slot: the key and the id it belongs to.
+         */
+        struct Entry {
+            Key    key;
+            size_t id;
+        };
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        std::vector<Entry>  heap_;  // Heap-ordered entries.
+        std::vector<size_t> pos_;   // pos_[id] = slot in heap_, or npos if absent.
+        Compare             comp_;  // Priority comparison.
+
+        /// @brief Writes an entry into a slot and records its position.
+        void place(size_t slot, Entry&& entry);
+        void siftUp(size_t slot);
+        void siftDown(size_t slot);
+        /// @brief Throws std::invalid_argument if id is not in the queue.
+        size_t slotOf(size_t id) const;
+
+    public:
+        /**
+         * @brief Constructs an empty queue.
+         * @param capacity The expected id range [0, capacity). Larger ids grow the table.
+         */
+        explicit IndexedPriorityQueue(size_t capacity = 0, const Compare& comp = Compare());
+
+        /**
+         * @brief Inserts an id with the given key. O(log_d n).
+         * @throws std::invalid_argument if the id is already present.
+         */
+        void push(size_t id, const Key& key);
+
+        /**
+         * @brief Lowers an id's key (raises its priority). O(log_d n).
+         * @throws std::invalid_argument if the id is absent or the new key has lower priority.
+         */
+        void decreaseKey(size_t id, const Key& key);
+
+        /**
+         * @brief Sets an id's key to any value, moving it up or down. O(d log_d n).
+         * @throws std::invalid_argument if the id is absent.
+         */
+        void update(size_t id, const Key& key);
+
+        /**
+         * @brief Removes an id from the queue. O(d log_d n).
+         * @return false if the id was not present.
+         */
+        bool erase(size_t id);
+
+        /**
+         * @brief Removes the top entry. O(d log_d n).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns the id with the highest priority. O(1).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        size_t top() const;
+
+        /**
+         * @brief Returns the key of the top entry. O(1).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        const Key& topKey() const;
+
+        /**
+         * @brief Returns the current key of an id. O(1).
+         * @throws std::invalid_argument if the id is absent.
+         */
+        const Key& keyOf(size_t id) const;
+
+        /// @brief Checks whether an id is currently in the queue. O(1).
+        bool contains(size_t id) const;
+
+        /// @brief Returns the number of entries. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the queue is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Removes all entries. O(n).
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "IndexedPriorityQueue.tpp"
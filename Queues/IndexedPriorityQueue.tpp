@@ -0,0 +1,151 @@
+#include <utility>
+
+namespace dsa {
+
+    template<typename Key, typename Compare, size_t Arity>
+    IndexedPriorityQueue<Key, Compare, Arity>::IndexedPriorityQueue(size_t capacity, const Compare& comp)
+        : pos_(capacity, npos), comp_(comp) {
+        heap_.reserve(capacity);
+    }
+
+    // Heap maintenance
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::place(size_t slot, Entry&& entry) {
+        pos_[entry.id] = slot;
+        heap_[slot] = std::move(entry);
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::siftUp(size_t slot) {
+        Entry entry = std::move(heap_[slot]);
+        while (slot > 0) {
+            size_t parent = (slot - 1) / Arity;
+            if (!comp_(entry.key, heap_[parent].key)) break;
+            place(slot, std::move(heap_[parent]));
+            slot = parent;
+        }
+        place(slot, std::move(entry));
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::siftDown(size_t slot) {
+        size_t n = heap_.size();
+        Entry entry = std::move(heap_[slot]);
+
+        while (true) {
+            size_t first = Arity * slot + 1;
+            if (first >= n) break;
+
+            size_t last = first + Arity < n ? first + Arity : n;
+            size_t best = first;
+            for (size_t c = first + 1; c < last; ++c) {
+                if (comp_(heap_[c].key, heap_[best].key)) best = c;
+            }
+
+            if (!comp_(heap_[best].key, entry.key)) break;
+            place(slot, std::move(heap_[best]));
+            slot = best;
+        }
+        place(slot, std::move(entry));
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    size_t IndexedPriorityQueue<Key, Compare, Arity>::slotOf(size_t id) const {
+        if (!contains(id)) throw std::invalid_argument("Id is not in the priority queue.");
+        return pos_[id];
+    }
+
+    // Core operations
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::push(size_t id, const Key& key) {
+        if (contains(id)) throw std::invalid_argument("Id is already in the priority queue.");
+        if (id >= pos_.size()) pos_.resize(id + 1, npos);
+
+        heap_.push_back(Entry{key, id});
+        siftUp(heap_.size() - 1);
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::decreaseKey(size_t id, const Key& key) {
+        size_t slot = slotOf(id);
+        if (comp_(heap_[slot].key, key))
+            throw std::invalid_argument("decreaseKey: new key has lower priority than the current key.");
+
+        heap_[slot].key = key;
+        siftUp(slot);
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::update(size_t id, const Key& key) {
+        size_t slot = slotOf(id);
+        bool raised = comp_(key, heap_[slot].key);
+
+        heap_[slot].key = key;
+        if (raised) siftUp(slot);
+        else siftDown(slot);
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    bool IndexedPriorityQueue<Key, Compare, Arity>::erase(size_t id) {
+        if (!contains(id)) return false;
+
+        size_t slot = pos_[id];
+        pos_[id] = npos;
+        Entry last = std::move(heap_.back());
+        heap_.pop_back();
+        if (slot == heap_.size()) return true; // erased the last slot
+
+        // Fill the hole with the former last entry, then fix it in either direction.
+        bool raised = comp_(last.key, heap_[slot].key);
+        place(slot, std::move(last));
+        if (raised) siftUp(slot);
+        else siftDown(slot);
+        return true;
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::pop() {
+        if (heap_.empty()) throw std::runtime_error("IndexedPriorityQueue is empty. Cannot pop.");
+        erase(heap_.front().id);
+    }
+
+    // Accessors
+    template<typename Key, typename Compare, size_t Arity>
+    size_t IndexedPriorityQueue<Key, Compare, Arity>::top() const {
+        if (heap_.empty()) throw std::runtime_error("IndexedPriorityQueue is empty. No top element.");
+        return heap_.front().id;
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    const Key& IndexedPriorityQueue<Key, Compare, Arity>::topKey() const {
+        if (heap_.empty()) throw std::runtime_error("IndexedPriorityQueue is empty. No top element.");
+        return heap_.front().key;
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    const Key& IndexedPriorityQueue<Key, Compare, Arity>::keyOf(size_t id) const {
+        return heap_[slotOf(id)].key;
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    bool IndexedPriorityQueue<Key, Compare, Arity>::contains(size_t id) const {
+        return id < pos_.size() && pos_[id] != npos;
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    size_t IndexedPriorityQueue<Key, Compare, Arity>::size() const {
+        return heap_.size();
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    bool IndexedPriorityQueue<Key, Compare, Arity>::isEmpty() const {
+        return heap_.empty();
+    }
+
+    template<typename Key, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<Key, Compare, Arity>::clear() {
+        for (const Entry& entry : heap_) pos_[entry.id] = npos;
+        heap_.clear();
+    }
+
+} // namespace dsa
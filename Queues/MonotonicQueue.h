@@ -0,0 +1,73 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include "Deque.h"
+
+namespace dsa {
+    /**
+     * @brief A FIFO queue that also reports its extreme element in O(1).
+     *
+     * Alongside the element count, a dsa::Deque keeps only the candidates that
+     * can still become the extreme: each push discards from the back every
+     * candidate it dominates, so the deque stays sorted by Compare and its front
+     * is always the answer. Every element is pushed and popped from the deque at
+     * most once, giving amortized O(1) push() and pop().
+     *
+     * This is the classic sliding-window min/max: push() the entering element,
+     * pop() the leaving one, read current().
+     *
+     * @tparam T The type of element stored.
+     * @tparam Compare Comparison functor; current() is the element x for which
+     *         Compare(y, x) is false for every other y (the minimum with std::less,
+     *         the maximum with std::greater).
+     */
+    template<typename T, typename Compare = std::less<T>>
+    class MonotonicQueue {
+    private:
+        /// @brief A candidate, tagged with its position in the push sequence.
+        struct Entry {
+            T      value;
+            size_t seq;
+        };
+
+        Deque<Entry> candidates_;   // Sorted by Compare from front to back.
+        size_t       pushed_ = 0;   // Sequence number of the next push.
+        size_t       popped_ = 0;   // Sequence number of the oldest element.
+        Compare      comp_;
+
+    public:
+        /// @brief Constructs an empty queue.
+        explicit MonotonicQueue(const Compare& comp = Compare());
+
+        /**
+         * @brief Appends an element to the back of the queue. Amortized O(1).
+         * @param value The value to append.
+         */
+        void push(const T& value);
+
+        /**
+         * @brief Removes the oldest element. Amortized O(1).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns the extreme element under Compare. O(1).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        T current() const;
+
+        /// @brief Returns the number of elements. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the queue is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Removes all elements. O(k) for k retained candidates.
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "MonotonicQueue.tpp"
@@ -0,0 +1,46 @@
+namespace dsa {
+
+    template<typename T, typename Compare>
+    MonotonicQueue<T, Compare>::MonotonicQueue(const Compare& comp) : comp_(comp) {}
+
+    template<typename T, typename Compare>
+    void MonotonicQueue<T, Compare>::push(const T& value) {
+        // A newer element that is at least as good makes older ones unreachable.
+        while (!candidates_.isEmpty() && !comp_(candidates_.peekBack().value, value)) {
+            candidates_.popBack();
+        }
+        candidates_.pushBack(Entry{value, pushed_++});
+    }
+
+    template<typename T, typename Compare>
+    void MonotonicQueue<T, Compare>::pop() {
+        if (isEmpty()) throw std::runtime_error("MonotonicQueue is empty. Cannot pop.");
+
+        // The oldest element is still a candidate only if nothing evicted it.
+        if (candidates_.peekFront().seq == popped_) candidates_.popFront();
+        ++popped_;
+    }
+
+    template<typename T, typename Compare>
+    T MonotonicQueue<T, Compare>::current() const {
+        if (isEmpty()) throw std::runtime_error("MonotonicQueue is empty. No current element.");
+        return candidates_.peekFront().value;
+    }
+
+    template<typename T, typename Compare>
+    size_t MonotonicQueue<T, Compare>::size() const {
+        return pushed_ - popped_;
+    }
+
+    template<typename T, typename Compare>
+    bool MonotonicQueue<T, Compare>::isEmpty() const {
+        return pushed_ == popped_;
+    }
+
+    template<typename T, typename Compare>
+    void MonotonicQueue<T, Compare>::clear() {
+        while (!candidates_.isEmpty()) candidates_.popBack();
+        pushed_ = popped_ = 0;
+    }
+
+} // namespace dsa
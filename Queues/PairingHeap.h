@@ -0,0 +1,154 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include "../Containers/NodePool.h"
+
+namespace dsa {
+    /**
+     * @brief A meldable pairing heap with handle-based decreaseKey.
+     *
+     * A pairing heap is a heap-ordered multiway tree stored as leftmost-child /
+     * right-sibling links. Insert and meld just link two roots (O(1)); pop does
+     * a two-pass pairing of the root's children (amortized O(log n)); decreaseKey
+     * cuts the node's subtree and links it back at the root (amortized O(log n)).
+     *
+     * Nodes come from a dsa::NodePool, so meld() never copies or re-pushes
+     * elements. By default each heap owns its pool and meld() absorbs the other
+     * heap's chunks in O(1). Heaps that are melded over and over (e.g. per-shard
+     * heaps folded into a global heap every tick) should instead be constructed
+     * over one shared Pool: meld() then only links the roots, and the slots the
+     * global heap frees are reused by the shards' next pushes.
+     *
+     * @tparam T The type of element stored.
+     * @tparam Compare Comparison functor; Compare(a, b) is true if a has priority over b.
+     */
+    template<typename T, typename Compare = std::less<T>>
+    class PairingHeap {
+    private:
+        /**
+         * @brief A tree node. `prev` is the parent for a leftmost child and the
+         * left sibling otherwise, which makes cutting a subtree O(1).
+         */
+        struct Node {
+            T     value;
+            Node* child   = nullptr;
+            Node* sibling = nullptr;
+            Node* prev    = nullptr;
+
+            explicit Node(const T& v) : value(v) {}
+        };
+
+    public:
+        /// @brief The node pool type; share one between heaps that are melded repeatedly.
+        using Pool = NodePool<Node>;
+
+        /**
+         * @brief An opaque reference to an element, returned by push().
+         * Valid until the element is popped or erased, and across meld().
+         */
+        class Handle {
+        public:
+            Handle() = default;
+        private:
+            friend class PairingHeap;
+            explicit Handle(Node* n) : node(n) {}
+            Node* node = nullptr;
+        };
+
+        /// @brief Constructs an empty heap that owns its node pool.
+        explicit PairingHeap(const Compare& comp = Compare());
+        /**
+         * @brief Constructs an empty heap that allocates its nodes from a shared pool.
+         * @param pool The pool; must outlive the heap.
+         */
+        explicit PairingHeap(Pool& pool, const Compare& comp = Compare());
+        /// @brief Destroys all remaining elements.
+        ~PairingHeap();
+
+        PairingHeap(const PairingHeap&) = delete;
+        PairingHeap& operator=(const PairingHeap&) = delete;
+        /// @brief Move constructor. Takes ownership of another heap's nodes.
+        PairingHeap(PairingHeap&& other) noexcept;
+        /// @brief Move assignment operator. Takes ownership of another heap's nodes.
+        PairingHeap& operator=(PairingHeap&& other) noexcept;
+
+        /**
+         * @brief Inserts an element. O(1).
+         * @param value The value to insert.
+         * @return A handle for decreaseKey() or erase().
+         */
+        Handle push(const T& value);
+
+        /**
+         * @brief Removes the top element. Amortized O(log n).
+         * @throws std::runtime_error if the heap is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns a const reference to the top element. O(1).
+         * @throws std::runtime_error if the heap is empty.
+         */
+        const T& top() const;
+
+        /**
+         * @brief Raises an element's priority to a new value. Amortized O(log n).
+         * @param handle The element to change.
+         * @param value The new value; must not have lower priority than the current one.
+         * @throws std::invalid_argument if the handle is empty or the value has lower priority.
+         */
+        void decreaseKey(Handle handle, const T& value);
+
+        /**
+         * @brief Removes an arbitrary element. Amortized O(log n).
+         * @throws std::invalid_argument if the handle is empty.
+         */
+        void erase(Handle handle);
+
+        /**
+         * @brief Returns the value an element currently holds. O(1).
+         * @throws std::invalid_argument if the handle is empty.
+         */
+        const T& valueOf(Handle handle) const;
+
+        /**
+         * @brief Moves every element of another heap into this one. O(1).
+         * Handles into other remain valid and now refer to elements of this heap.
+         * If both heaps share a pool only the roots are linked; otherwise other
+         * must own its pool, whose chunks this heap's pool takes over for good.
+         * @param other The heap to meld; left empty.
+         * @throws std::invalid_argument if other draws from a different shared pool.
+         */
+        void meld(PairingHeap& other);
+
+        /// @brief Returns the number of elements. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the heap is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Removes all elements. O(n).
+        void clear();
+
+    private:
+        Node*   root_ = nullptr;
+        size_t  size_ = 0;
+        Pool    ownPool_;         // Used unless a shared pool was passed in.
+        Pool*   pool_ = &ownPool_;
+        Compare comp_;
+
+        /// @brief Checks if the heap allocates from its own pool.
+        bool ownsPool() const { return pool_ == &ownPool_; }
+
+        /// @brief Links two heap-ordered trees; the loser becomes the winner's first child.
+        Node* link(Node* a, Node* b);
+        /// @brief Detaches a non-root node (with its subtree) from its parent.
+        void cut(Node* node);
+        /// @brief Merges a sibling list into one tree using two-pass pairing.
+        Node* mergePairs(Node* first);
+    };
+
+} // namespace dsa
+
+#include "PairingHeap.tpp"
@@ -0,0 +1,218 @@
+#include <utility>
+
+namespace dsa {
+
+    template<typename T, typename Compare>
+    PairingHeap<T, Compare>::PairingHeap(const Compare& comp) : comp_(comp) {}
+
+    template<typename T, typename Compare>
+    PairingHeap<T, Compare>::PairingHeap(Pool& pool, const Compare& comp) : pool_(&pool), comp_(comp) {}
+
+    template<typename T, typename Compare>
+    PairingHeap<T, Compare>::~PairingHeap() {
+        clear();
+    }
+
+    // Move constructor
+    template<typename T, typename Compare>
+    PairingHeap<T, Compare>::PairingHeap(PairingHeap&& other) noexcept
+        : root_(other.root_), size_(other.size_), comp_(other.comp_) {
+        // A shared pool stays shared; an owned one moves with the nodes.
+        if (other.ownsPool()) ownPool_ = std::move(other.ownPool_);
+        else pool_ = other.pool_;
+
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    // Move assignment operator
+    template<typename T, typename Compare>
+    PairingHeap<T, Compare>& PairingHeap<T, Compare>::operator=(PairingHeap&& other) noexcept {
+        if (this == &other) return *this;
+
+        clear();
+        root_ = other.root_;
+        size_ = other.size_;
+        if (other.ownsPool()) {
+            ownPool_ = std::move(other.ownPool_);
+            pool_ = &ownPool_;
+        } else {
+            pool_ = other.pool_;
+        }
+        comp_ = other.comp_;
+
+        other.root_ = nullptr;
+        other.size_ = 0;
+        return *this;
+    }
+
+    // Tree helpers
+    template<typename T, typename Compare>
+    typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::link(Node* a, Node* b) {
+        if (!a) return b;
+        if (!b) return a;
+        if (comp_(b->value, a->value)) std::swap(a, b);
+
+        // b becomes the leftmost child of a.
+        b->sibling = a->child;
+        if (a->child) a->child->prev = b;
+        b->prev = a;
+        a->child = b;
+
+        a->sibling = nullptr;
+        a->prev = nullptr;
+        return a;
+    }
+
+    template<typename T, typename Compare>
+    void PairingHeap<T, Compare>::cut(Node* node) {
+        if (node->prev->child == node) node->prev->child = node->sibling; // leftmost child
+        else node->prev->sibling = node->sibling;
+        if (node->sibling) node->sibling->prev = node->prev;
+
+        node->sibling = nullptr;
+        node->prev = nullptr;
+    }
+
+    template<typename T, typename Compare>
+    typename PairingHeap<T, Compare>::Node* PairingHeap<T, Compare>::mergePairs(Node* first) {
+        if (!first) return nullptr;
+
+        // Pass 1 (left to right): link adjacent pairs, stacking the results
+        // through their sibling pointers so no extra storage is needed.
+        Node* paired = nullptr;
+        while (first) {
+            Node* a = first;
+            Node* b = a->sibling;
+            first = b ? b->sibling : nullptr;
+
+            a->sibling = a->prev = nullptr;
+            if (b) b->sibling = b->prev = nullptr;
+
+            Node* tree = link(a, b);
+            tree->sibling = paired;
+            paired = tree;
+        }
+
+        // Pass 2 (right to left): fold the stacked trees into one.
+        Node* result = paired;
+        paired = paired->sibling;
+        result->sibling = nullptr;
+        while (paired) {
+            Node* next = paired->sibling;
+            paired->sibling = nullptr;
+            result = link(result, paired);
+            paired = next;
+        }
+        return result;
+    }
+
+    // Core operations
+    template<typename T, typename Compare>
+    typename PairingHeap<T, Compare>::Handle PairingHeap<T, Compare>::push(const T& value) {
+        Node* node = pool_->create(value);
+        root_ = link(root_, node);
+        ++size_;
+        return Handle(node);
+    }
+
+    template<typename T, typename Compare>
+    void PairingHeap<T, Compare>::pop() {
+        if (!root_) throw std::runtime_error("PairingHeap is empty. Cannot pop.");
+
+        Node* oldRoot = root_;
+        root_ = mergePairs(oldRoot->child);
+        pool_->destroy(oldRoot);
+        --size_;
+    }
+
+    template<typename T, typename Compare>
+    const T& PairingHeap<T, Compare>::top() const {
+        if (!root_) throw std::runtime_error("PairingHeap is empty. No top element.");
+        return root_->value;
+    }
+
+    template<typename T, typename Compare>
+    void PairingHeap<T, Compare>::decreaseKey(Handle handle, const T& value) {
+        Node* node = handle.node;
+        if (!node) throw std::invalid_argument("PairingHeap handle is empty.");
+        if (comp_(node->value, value))
+            throw std::invalid_argument("decreaseKey: new value has lower priority than the current value.");
+
+        node->value = value;
+        if (node == root_) return;
+
+        cut(node);
+        root_ = link(root_, node);
+    }
+
+    template<typename T, typename Compare>
+    void PairingHeap<T, Compare>::erase(Handle handle) {
+        Node* node = handle.node;
+        if (!node) throw std::invalid_argument("PairingHeap handle is empty.");
+        if (node == root_) {
+            pop();
+            return;
+        }
+
+        // Detach the subtree, merge its children back in at the root.
+        cut(node);
+        root_ = link(root_, mergePairs(node->child));
+        pool_->destroy(node);
+        --size_;
+    }
+
+    template<typename T, typename Compare>
+    const T& PairingHeap<T, Compare>::valueOf(Handle handle) const {
+        if (!handle.node) throw std::invalid_argument("PairingHeap handle is empty.");
+        return handle.node->value;
+    }
+
+    template<typename T, typename Compare>
+    void PairingHeap<T, Compare>::meld(PairingHeap& other) {
+        if (this == &other) return;
+        if (pool_ != other.pool_) {
+            // Stealing a shared pool would free nodes still owned by its other heaps.
+            if (!other.ownsPool())
+                throw std::invalid_argument("meld: heaps draw from different shared pools.");
+            pool_->absorb(other.ownPool_);
+        }
+
+        root_ = link(root_, other.root_);
+        size_ += other.size_;
+
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    // Capacity & state
+    template<typename T, typename Compare>
+    size_t PairingHeap<T, Compare>::size() const {
+        return size_;
+    }
+
+    template<typename T, typename Compare>
+    bool PairingHeap<T, Compare>::isEmpty() const {
+        return size_ == 0;
+    }
+
+    template<typename T, typename Compare>
+    void PairingHeap<T, Compare>::clear() {
+        // Iterative teardown: splice each node's children into the work list.
+        Node* work = root_;
+        while (work) {
+            Node* node = work;
+            work = node->sibling;
+            if (node->child) {
+                Node* last = node->child;
+                while (last->sibling) last = last->sibling;
+                last->sibling = work;
+                work = node->child;
+            }
+            pool_->destroy(node);
+        }
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+} // namespace dsa
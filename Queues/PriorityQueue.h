@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief An array-backed d-ary heap priority queue.
+     *
+     * The element at the top is the one that no other element compares before,
+     * so with the default std::less<T> this is a min-heap. Wider heaps (4-ary,
+     * 8-ary) are shallower, trading a few extra comparisons per level for fewer
+     * levels and better cache behaviour on sift-down; they usually win for
+     * large heaps with many decreases/pushes.
+     *
+     * @tparam T The type of element stored.
+     * @tparam Compare Comparison functor; Compare(a, b) is true if a has priority over b.
+     * @tparam Arity The number of children per node (2 = binary heap).
+     */
+    template<typename T, typename Compare = std::less<T>, size_t Arity = 2>
+    class PriorityQueue {
+        static_assert(Arity >= 2, "PriorityQueue arity must be at least 2.");
+
+    private:
+        std::vector<T> heap_;   // Heap-ordered elements; heap_[0] is the top.
+        Compare        comp_;   // Priority comparison.
+
+        /// @brief Moves the element at index i up until the heap property holds.
+        void siftUp(size_t i);
+        /// @brief Moves the element at index i down until the heap property holds.
+        void siftDown(size_t i);
+        /// @brief Restores the heap property over the whole array. O(n).
+        void buildHeap();
+
+    public:
+        /// @brief Constructs an empty priority queue.
+        explicit PriorityQueue(const Compare& comp = Compare());
+
+        /**
+         * @brief Constructs a priority queue from a range in O(n).
+         * @param first Iterator to the first element.
+         * @param last Iterator past the last element.
+         */
+        template<typename InputIt>
+        PriorityQueue(InputIt first, InputIt last, const Compare& comp = Compare());
+
+        /**
+         * @brief Inserts an element. O(log_d n).
+         * @param value The value to insert.
+         */
+        void push(const T& value);
+        void push(T&& value);
+
+        /**
+         * @brief Removes the top element. O(d log_d n).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns a const reference to the top element. O(1).
+         * @throws std::runtime_error if the queue is empty.
+         */
+        const T& top() const;
+
+        /**
+         * @brief Replaces the contents with the elements of a range. O(n).
+         * Uses bottom-up heap construction rather than n pushes.
+         */
+        template<typename InputIt>
+        void heapify(InputIt first, InputIt last);
+
+        /// @brief Reserves storage for at least n elements. O(n).
+        void reserve(size_t n);
+
+        /// @brief Returns the number of elements. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the queue is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Removes all elements. O(n).
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "PriorityQueue.tpp"
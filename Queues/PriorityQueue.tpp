@@ -0,0 +1,116 @@
+#include <utility>
+
+namespace dsa {
+
+    // Constructors
+    template<typename T, typename Compare, size_t Arity>
+    PriorityQueue<T, Compare, Arity>::PriorityQueue(const Compare& comp) : comp_(comp) {}
+
+    template<typename T, typename Compare, size_t Arity>
+    template<typename InputIt>
+    PriorityQueue<T, Compare, Arity>::PriorityQueue(InputIt first, InputIt last, const Compare& comp)
+        : heap_(first, last), comp_(comp) {
+        buildHeap();
+    }
+
+    // Heap maintenance
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::siftUp(size_t i) {
+        // Move a "hole" up instead of swapping at every level.
+        T value = std::move(heap_[i]);
+        while (i > 0) {
+            size_t parent = (i - 1) / Arity;
+            if (!comp_(value, heap_[parent])) break;
+            heap_[i] = std::move(heap_[parent]);
+            i = parent;
+        }
+        heap_[i] = std::move(value);
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::siftDown(size_t i) {
+        size_t n = heap_.size();
+        T value = std::move(heap_[i]);
+
+        while (true) {
+            size_t first = Arity * i + 1;
+            if (first >= n) break;
+
+            // Pick the highest-priority child among up to Arity siblings.
+            size_t last = first + Arity < n ? first + Arity : n;
+            size_t best = first;
+            for (size_t c = first + 1; c < last; ++c) {
+                if (comp_(heap_[c], heap_[best])) best = c;
+            }
+
+            if (!comp_(heap_[best], value)) break;
+            heap_[i] = std::move(heap_[best]);
+            i = best;
+        }
+        heap_[i] = std::move(value);
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::buildHeap() {
+        if (heap_.size() < 2) return;
+        for (size_t i = (heap_.size() - 2) / Arity + 1; i-- > 0;) {
+            siftDown(i);
+        }
+    }
+
+    // Core operations
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::push(const T& value) {
+        heap_.push_back(value);
+        siftUp(heap_.size() - 1);
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::push(T&& value) {
+        heap_.push_back(std::move(value));
+        siftUp(heap_.size() - 1);
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::pop() {
+        if (heap_.empty()) throw std::runtime_error("PriorityQueue is empty. Cannot pop.");
+        heap_.front() = std::move(heap_.back());
+        heap_.pop_back();
+        if (!heap_.empty()) siftDown(0);
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    const T& PriorityQueue<T, Compare, Arity>::top() const {
+        if (heap_.empty()) throw std::runtime_error("PriorityQueue is empty. No top element.");
+        return heap_.front();
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    template<typename InputIt>
+    void PriorityQueue<T, Compare, Arity>::heapify(InputIt first, InputIt last) {
+        heap_.assign(first, last);
+        buildHeap();
+    }
+
+    // Capacity & state
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::reserve(size_t n) {
+        heap_.reserve(n);
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    size_t PriorityQueue<T, Compare, Arity>::size() const {
+        return heap_.size();
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    bool PriorityQueue<T, Compare, Arity>::isEmpty() const {
+        return heap_.empty();
+    }
+
+    template<typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::clear() {
+        heap_.clear();
+    }
+
+} // namespace dsa
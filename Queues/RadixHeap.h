@@ -0,0 +1,123 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief A monotone radix heap over non-negative integer keys.
+     *
+     * A radix heap only works when keys never drop below the last minimum
+     * extracted, which is exactly what Dijkstra's algorithm guarantees: every
+     * pushed or decreased key must be at least the last key seen through top(),
+     * topKey() or pop(). Entries are kept in buckets by the highest bit in which
+     * their key differs from that last minimum; bucket 0 holds the entries equal
+     * to it. When bucket 0 runs dry, the lowest non-empty bucket is redistributed
+     * into strictly lower buckets, so each entry moves at most (bits in Key)
+     * times over its lifetime.
+     *
+     * The interface matches dsa::IndexedPriorityQueue (integer handles with
+     * decreaseKey), so the two are interchangeable in dsa::dijkstra.
+     *
+     * @tparam Key An integral key type. Negative keys are rejected.
+     */
+    template<typename Key = unsigned int>
+    class RadixHeap {
+        static_assert(std::is_integral_v<Key>, "RadixHeap keys must be integral.");
+
+    private:
+        static constexpr size_t npos = static_cast<size_t>(-1);
+        static constexpr size_t numBuckets = std::numeric_limits<std::make_unsigned_t<Key>>::digits + 1;
+
+        /**
+         * @brief Where an id lives: its bucket and its index within the bucket.
+         */
+        struct Location {
+            size_t bucket = npos;
+            size_t slot   = 0;
+        };
+
+        // Redistribution happens lazily when the top is inspected, hence mutable.
+        mutable std::vector<std::vector<size_t>> buckets_;  // buckets_[b] holds ids.
+        mutable std::vector<Location> where_;               // where_[id], bucket == npos if absent.
+        std::vector<uint64_t> keys_;                        // keys_[id]
+        mutable uint64_t last_ = 0;                         // Smallest key still allowed.
+        size_t size_ = 0;
+
+        /// @brief Returns the bucket an entry with this key belongs in.
+        size_t bucketFor(uint64_t key) const;
+        void link(size_t id) const;
+        void unlink(size_t id);
+        /// @brief Makes bucket 0 non-empty (if the heap is), advancing the bound to the minimum.
+        void refill() const;
+        /// @brief Converts and validates a key against the monotone bound.
+        uint64_t checkedKey(const Key& key) const;
+
+    public:
+        /**
+         * @brief Constructs an empty radix heap.
+         * @param capacity The expected id range [0, capacity). Larger ids grow the tables.
+         */
+        explicit RadixHeap(size_t capacity = 0);
+
+        /**
+         * @brief Inserts an id with the given key. O(1).
+         * @throws std::invalid_argument if the id is present or the key is below the last top key.
+         */
+        void push(size_t id, const Key& key);
+
+        /**
+         * @brief Lowers an id's key. O(1).
+         * @throws std::invalid_argument if the id is absent, the key grows, or it breaks monotonicity.
+         */
+        void decreaseKey(size_t id, const Key& key);
+
+        /**
+         * @brief Removes an id from the heap. O(1).
+         * @return false if the id was not present.
+         */
+        bool erase(size_t id);
+
+        /**
+         * @brief Removes the top entry. Amortized O(log C), C = the largest key.
+         * @throws std::runtime_error if the heap is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns an id with the smallest key. Amortized O(log C).
+         * @throws std::runtime_error if the heap is empty.
+         */
+        size_t top() const;
+
+        /**
+         * @brief Returns the smallest key. Amortized O(log C).
+         * @throws std::runtime_error if the heap is empty.
+         */
+        Key topKey() const;
+
+        /**
+         * @brief Returns the current key of an id. O(1).
+         * @throws std::invalid_argument if the id is absent.
+         */
+        Key keyOf(size_t id) const;
+
+        /// @brief Checks whether an id is currently in the heap. O(1).
+        bool contains(size_t id) const;
+
+        /// @brief Returns the number of entries. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the heap is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Removes all entries and resets the monotone bound to 0. O(n).
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "RadixHeap.tpp"
@@ -0,0 +1,157 @@
+namespace dsa {
+
+    template<typename Key>
+    RadixHeap<Key>::RadixHeap(size_t capacity)
+        : buckets_(numBuckets), where_(capacity), keys_(capacity, 0) {}
+
+    // Helpers
+    template<typename Key>
+    size_t RadixHeap<Key>::bucketFor(uint64_t key) const {
+        uint64_t diff = key ^ last_;
+        if (diff == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        return 64 - static_cast<size_t>(__builtin_clzll(diff));
+#else
+        size_t width = 0;
+        while (diff) { diff >>= 1; ++width; }
+        return width;
+#endif
+    }
+
+    template<typename Key>
+    void RadixHeap<Key>::link(size_t id) const {
+        size_t b = bucketFor(keys_[id]);
+        where_[id] = Location{b, buckets_[b].size()};
+        buckets_[b].push_back(id);
+    }
+
+    template<typename Key>
+    void RadixHeap<Key>::unlink(size_t id) {
+        // Swap-remove: move the bucket's last id into the vacated slot.
+        Location loc = where_[id];
+        std::vector<size_t>& bucket = buckets_[loc.bucket];
+        size_t moved = bucket.back();
+        bucket[loc.slot] = moved;
+        where_[moved].slot = loc.slot;
+        bucket.pop_back();
+        where_[id].bucket = npos;
+    }
+
+    template<typename Key>
+    void RadixHeap<Key>::refill() const {
+        if (size_ == 0 || !buckets_[0].empty()) return;
+
+        size_t b = 1;
+        while (buckets_[b].empty()) ++b;
+
+        // The new bound is the smallest key in the lowest non-empty bucket;
+        // relative to it every entry of that bucket lands in a lower bucket.
+        uint64_t smallest = keys_[buckets_[b].front()];
+        for (size_t id : buckets_[b]) {
+            if (keys_[id] < smallest) smallest = keys_[id];
+        }
+        last_ = smallest;
+
+        std::vector<size_t> moving;
+        moving.swap(buckets_[b]);
+        for (size_t id : moving) link(id);
+    }
+
+    template<typename Key>
+    uint64_t RadixHeap<Key>::checkedKey(const Key& key) const {
+        if constexpr (std::is_signed_v<Key>) {
+            if (key < 0) throw std::invalid_argument("RadixHeap keys must be non-negative.");
+        }
+        uint64_t k = static_cast<uint64_t>(key);
+        if (k < last_) throw std::invalid_argument("RadixHeap key is below the last extracted key.");
+        return k;
+    }
+
+    // Core operations
+    template<typename Key>
+    void RadixHeap<Key>::push(size_t id, const Key& key) {
+        if (contains(id)) throw std::invalid_argument("Id is already in the radix heap.");
+        uint64_t k = checkedKey(key);
+        if (id >= where_.size()) {
+            where_.resize(id + 1);
+            keys_.resize(id + 1, 0);
+        }
+
+        keys_[id] = k;
+        link(id);
+        ++size_;
+    }
+
+    template<typename Key>
+    void RadixHeap<Key>::decreaseKey(size_t id, const Key& key) {
+        if (!contains(id)) throw std::invalid_argument("Id is not in the radix heap.");
+        uint64_t k = checkedKey(key);
+        if (k > keys_[id]) throw std::invalid_argument("decreaseKey: new key is larger than the current key.");
+
+        unlink(id);
+        keys_[id] = k;
+        link(id);
+    }
+
+    template<typename Key>
+    bool RadixHeap<Key>::erase(size_t id) {
+        if (!contains(id)) return false;
+        unlink(id);
+        --size_;
+        return true;
+    }
+
+    template<typename Key>
+    void RadixHeap<Key>::pop() {
+        if (size_ == 0) throw std::runtime_error("RadixHeap is empty. Cannot pop.");
+        refill();
+        erase(buckets_[0].back());
+    }
+
+    // Accessors
+    template<typename Key>
+    size_t RadixHeap<Key>::top() const {
+        if (size_ == 0) throw std::runtime_error("RadixHeap is empty. No top element.");
+        refill();
+        return buckets_[0].back();
+    }
+
+    template<typename Key>
+    Key RadixHeap<Key>::topKey() const {
+        if (size_ == 0) throw std::runtime_error("RadixHeap is empty. No top element.");
+        refill();
+        return static_cast<Key>(last_);
+    }
+
+    template<typename Key>
+    Key RadixHeap<Key>::keyOf(size_t id) const {
+        if (!contains(id)) throw std::invalid_argument("Id is not in the radix heap.");
+        return static_cast<Key>(keys_[id]);
+    }
+
+    template<typename Key>
+    bool RadixHeap<Key>::contains(size_t id) const {
+        return id < where_.size() && where_[id].bucket != npos;
+    }
+
+    template<typename Key>
+    size_t RadixHeap<Key>::size() const {
+        return size_;
+    }
+
+    template<typename Key>
+    bool RadixHeap<Key>::isEmpty() const {
+        return size_ == 0;
+    }
+
+    template<typename Key>
+    void RadixHeap<Key>::clear() {
+        for (auto& bucket : buckets_) {
+            for (size_t id : bucket) where_[id].bucket = npos;
+            bucket.clear();
+        }
+        size_ = 0;
+        last_ = 0;
+    }
+
+} // namespace dsa
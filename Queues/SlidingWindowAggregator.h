@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include "../Stacks/Stack.h"
+
+namespace dsa {
+    /**
+     * @brief A FIFO queue that folds its contents with any associative operation.
+     *
+     * This is the two-stack queue: pushes go onto a back stack that keeps one
+     * running aggregate, pops come off a front stack whose entries each store
+     * the aggregate of themselves and everything newer in that stack. When the
+     * front runs dry the back stack is flipped onto it, recomputing those suffix
+     * aggregates once. Each element is flipped at most once, so push(), pop()
+     * and query() are all amortized O(1) with exactly one Op call per push and
+     * at most two per element overall.
+     *
+     * Op only has to be associative (sum, min, max, gcd, matrix product, ...);
+     * it need not be commutative or invertible, and no identity element is
+     * required. query() folds oldest to newest.
+     *
+     * @tparam T The type of element stored.
+     * @tparam Op Binary functor with T Op(const T&, const T&).
+     */
+    template<typename T, typename Op = std::plus<T>>
+    class SlidingWindowAggregator {
+    private:
+        /// @brief A value plus the fold of it and every newer front-stack value.
+        struct Entry {
+            T value;
+            T agg;
+        };
+
+        Stack<Entry> front_;            // Top is the oldest element.
+        Stack<T>     back_;             // Top is the newest element.
+        T            backAgg_ = T();    // Fold of back_, oldest to newest.
+        size_t       frontSize_ = 0;
+        size_t       backSize_ = 0;
+        Op           op_;
+
+        /// @brief Moves every back-stack element to the front stack.
+        void flip();
+
+    public:
+        /// @brief Constructs an empty window.
+        explicit SlidingWindowAggregator(const Op& op = Op());
+
+        /**
+         * @brief Appends an element at the newest end. O(1).
+         * @param value The value to append.
+         */
+        void push(const T& value);
+
+        /**
+         * @brief Removes the oldest element. Amortized O(1).
+         * @throws std::runtime_error if the window is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns the fold of all elements, oldest to newest. O(1).
+         * @throws std::runtime_error if the window is empty.
+         */
+        T query() const;
+
+        /// @brief Returns the number of elements. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the window is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Removes all elements. O(n).
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "SlidingWindowAggregator.tpp"
@@ -0,0 +1,60 @@
+namespace dsa {
+
+    template<typename T, typename Op>
+    SlidingWindowAggregator<T, Op>::SlidingWindowAggregator(const Op& op) : op_(op) {}
+
+    template<typename T, typename Op>
+    void SlidingWindowAggregator<T, Op>::flip() {
+        // Newest comes off first, so each pushed entry folds itself in front of
+        // the (newer) suffix already on the front stack.
+        while (!back_.isEmpty()) {
+            T value = back_.top();
+            back_.pop();
+            if (front_.isEmpty()) front_.push(Entry{value, value});
+            else front_.push(Entry{value, op_(value, front_.top().agg)});
+        }
+        frontSize_ = backSize_;
+        backSize_ = 0;
+    }
+
+    template<typename T, typename Op>
+    void SlidingWindowAggregator<T, Op>::push(const T& value) {
+        backAgg_ = backSize_ == 0 ? value : op_(backAgg_, value);
+        back_.push(value);
+        ++backSize_;
+    }
+
+    template<typename T, typename Op>
+    void SlidingWindowAggregator<T, Op>::pop() {
+        if (isEmpty()) throw std::runtime_error("SlidingWindowAggregator is empty. Cannot pop.");
+        if (frontSize_ == 0) flip();
+        front_.pop();
+        --frontSize_;
+    }
+
+    template<typename T, typename Op>
+    T SlidingWindowAggregator<T, Op>::query() const {
+        if (isEmpty()) throw std::runtime_error("SlidingWindowAggregator is empty. Nothing to query.");
+        if (frontSize_ == 0) return backAgg_;
+        if (backSize_ == 0) return front_.top().agg;
+        return op_(front_.top().agg, backAgg_);
+    }
+
+    template<typename T, typename Op>
+    size_t SlidingWindowAggregator<T, Op>::size() const {
+        return frontSize_ + backSize_;
+    }
+
+    template<typename T, typename Op>
+    bool SlidingWindowAggregator<T, Op>::isEmpty() const {
+        return frontSize_ + backSize_ == 0;
+    }
+
+    template<typename T, typename Op>
+    void SlidingWindowAggregator<T, Op>::clear() {
+        front_.clear();
+        back_.clear();
+        frontSize_ = backSize_ = 0;
+    }
+
+} // namespace dsa
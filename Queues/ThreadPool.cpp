@@ -0,0 +1,143 @@
+#include "ThreadPool.h"
+
+namespace dsa {
+
+    namespace {
+        // Identifies the pool and worker index of the calling thread.
+        thread_local const ThreadPool* currentPool = nullptr;
+        thread_local size_t currentIndex = 0;
+    }
+
+    ThreadPool::ThreadPool(size_t numThreads) : queued_(0), stopping_(false), pending_(0) {
+        if (numThreads == 0) {
+            numThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        // Create every deque before starting any thread, since workers steal
+        // from each other as soon as they run.
+        workers_.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            workers_.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < numThreads; ++i) {
+            workers_[i]->thread = std::thread(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            idle_.wait(lock, [this] { return pending_.load() == 0; });
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stopping_.store(true);
+        }
+        wakeUp_.notify_all();
+        for (auto& worker : workers_) {
+            worker->thread.join();
+        }
+    }
+
+    void ThreadPool::submit(Task task) {
+        Task* heapTask = new Task(std::move(task));
+        pending_.fetch_add(1);
+        queued_.fetch_add(1);
+
+        if (currentPool == this) {
+            workers_[currentIndex]->deque.pushBottom(heapTask);
+        } else {
+            std::lock_guard<std::mutex> lock(injectionMutex_);
+            injection_.enqueue(heapTask);
+        }
+
+        // Taking the lock orders this wake-up after a sleeper's predicate check.
+        { std::lock_guard<std::mutex> lock(sleepMutex_); }
+        wakeUp_.notify_one();
+    }
+
+    void ThreadPool::wait() {
+        if (currentPool == this) {
+            throw std::logic_error("ThreadPool::wait() called from one of its own tasks.");
+        }
+        {
+            std::unique_lock<std::mutex> lock(idleMutex_);
+            idle_.wait(lock, [this] { return pending_.load() == 0; });
+        }
+
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            std::swap(error, firstError_);
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+    size_t ThreadPool::threadCount() const {
+        return workers_.size();
+    }
+
+    int ThreadPool::currentWorker() const {
+        return currentPool == this ? static_cast<int>(currentIndex) : -1;
+    }
+
+    void ThreadPool::workerLoop(size_t index) {
+        currentPool = this;
+        currentIndex = index;
+
+        while (true) {
+            if (Task* task = acquireTask(index)) {
+                runTask(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wakeUp_.wait(lock, [this] { return stopping_.load() || queued_.load() > 0; });
+            if (stopping_.load() && queued_.load() == 0) return;
+        }
+    }
+
+    ThreadPool::Task* ThreadPool::acquireTask(size_t index) {
+        if (auto task = workers_[index]->deque.popBottom()) {
+            queued_.fetch_sub(1);
+            return *task;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(injectionMutex_);
+            if (!injection_.isEmpty()) {
+                Task* task = injection_.front();
+                injection_.dequeue();
+                queued_.fetch_sub(1);
+                return task;
+            }
+        }
+
+        // Steal, starting after our own index so thieves spread over victims.
+        size_t n = workers_.size();
+        for (size_t offset = 1; offset < n; ++offset) {
+            size_t victim = (index + offset) % n;
+            if (auto task = workers_[victim]->deque.steal()) {
+                queued_.fetch_sub(1);
+                return *task;
+            }
+        }
+        return nullptr;
+    }
+
+    void ThreadPool::runTask(Task* task) {
+        try {
+            (*task)();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            if (!firstError_) firstError_ = std::current_exception();
+        }
+        delete task;
+
+        if (pending_.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            idle_.notify_all();
+        }
+    }
+
+} // namespace dsa
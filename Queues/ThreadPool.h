@@ -0,0 +1,109 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "Queue.h"
+#include "WorkStealingDeque.h"
+
+namespace dsa {
+    /**
+     * @brief A fixed-size thread pool scheduling tasks by work stealing.
+     *
+     * Each worker owns a dsa::WorkStealingDeque. Tasks submitted from inside a
+     * worker go to the bottom of that worker's own deque, so recursive work
+     * (parallel traversal, divide-and-conquer sorting) stays on the thread that
+     * produced it. Idle workers steal from the top of other workers' deques.
+     * Tasks submitted from outside the pool land in a shared injection
+     * dsa::Queue, which workers only consult when their own deque is empty.
+     *
+     * If a task throws, the first exception is captured and rethrown by wait().
+     */
+    class ThreadPool {
+    public:
+        using Task = std::function<void()>;
+
+        /**
+         * @brief Starts the worker threads.
+         * @param numThreads Number of workers. 0 means std::thread::hardware_concurrency().
+         */
+        explicit ThreadPool(size_t numThreads = 0);
+
+        /**
+         * @brief Waits for all submitted tasks to finish, then joins the workers.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Schedules a task for execution. O(1) amortized.
+         * Called from a worker, the task is pushed to that worker's own deque;
+         * otherwise it goes to the shared injection queue.
+         * @param task The callable to run.
+         */
+        void submit(Task task);
+
+        /**
+         * @brief Blocks until every submitted task (including tasks spawned by
+         * other tasks) has finished. Must not be called from a task of this
+         * pool: the calling task would wait for itself.
+         * @throws std::logic_error if called from one of this pool's workers.
+         * @throws Rethrows the first exception thrown by a task since the last wait().
+         */
+        void wait();
+
+        /// @brief Returns the number of worker threads. O(1).
+        size_t threadCount() const;
+
+        /**
+         * @brief Returns the index of the calling worker in [0, threadCount()).
+         * @return The worker index, or -1 if the caller is not a worker of this pool.
+         */
+        int currentWorker() const;
+
+    private:
+        /**
+         * @brief Per-worker state, padded so neighbouring deques do not share lines.
+         */
+        struct alignas(64) Worker {
+            WorkStealingDeque<Task*> deque;
+            std::thread thread;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+
+        std::mutex injectionMutex_;
+        Queue<Task*> injection_;        // Tasks submitted from outside the pool.
+
+        std::mutex sleepMutex_;
+        std::condition_variable wakeUp_;
+        std::atomic<size_t> queued_;    // Tasks sitting in a deque or the injection queue.
+        std::atomic<bool> stopping_;
+
+        std::mutex idleMutex_;
+        std::condition_variable idle_;
+        std::atomic<size_t> pending_;   // Tasks submitted but not yet finished.
+
+        std::mutex errorMutex_;
+        std::exception_ptr firstError_;
+
+        /// @brief The main loop run by each worker thread.
+        void workerLoop(size_t index);
+
+        /// @brief Finds the next task: own deque, then injection queue, then stealing.
+        Task* acquireTask(size_t index);
+
+        /// @brief Runs a task, records exceptions and signals idleness.
+        void runTask(Task* task);
+    };
+
+} // namespace dsa
@@ -0,0 +1,220 @@
+#include "TimingWheel.h"
+#include <algorithm>
+#include <utility>
+
+namespace dsa {
+
+    namespace {
+        size_t highestBit(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - static_cast<size_t>(__builtin_clzll(x));
+#else
+            size_t bit = 0;
+            while (x >>= 1) ++bit;
+            return bit;
+#endif
+        }
+
+        size_t lowestBit(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(x));
+#else
+            size_t bit = 0;
+            while (!(x & 1)) { x >>= 1; ++bit; }
+            return bit;
+#endif
+        }
+    }
+
+    TimingWheel::TimingWheel(uint64_t now) : now_(now) {
+        std::fill(std::begin(heads_), std::end(heads_), kNil);
+    }
+
+    // Slot bookkeeping
+    void TimingWheel::link(uint32_t id) {
+        Timer& timer = timers_[id];
+        uint64_t diff = timer.expiry ^ now_;
+        size_t level = diff == 0 ? 0 : highestBit(diff) / kSlotBits;
+        size_t index = (timer.expiry >> (level * kSlotBits)) & kSlotMask;
+        size_t slot = level * kSlots + index;
+
+        timer.slot = static_cast<uint16_t>(slot);
+        timer.prev = kNil;
+        timer.next = heads_[slot];
+        if (timer.next != kNil) timers_[timer.next].prev = id;
+        heads_[slot] = id;
+        occupied_[level] |= uint64_t{1} << index;
+    }
+
+    void TimingWheel::unlink(uint32_t id) {
+        Timer& timer = timers_[id];
+        if (timer.prev != kNil) {
+            timers_[timer.prev].next = timer.next;
+        } else {
+            heads_[timer.slot] = timer.next;
+            if (timer.next == kNil)
+                occupied_[timer.slot / kSlots] &= ~(uint64_t{1} << (timer.slot % kSlots));
+        }
+        if (timer.next != kNil) timers_[timer.next].prev = timer.prev;
+    }
+
+    void TimingWheel::release(uint32_t id) {
+        Timer& timer = timers_[id];
+        timer.callback = nullptr;
+        timer.active = false;
+        ++timer.generation;
+        timer.next = freeHead_;
+        freeHead_ = id;
+        --count_;
+    }
+
+    // Scheduling
+    TimingWheel::TimerId TimingWheel::schedule(uint64_t delay, Callback callback) {
+        uint64_t deadline = delay > UINT64_MAX - now_ ? UINT64_MAX : now_ + delay;
+        return scheduleAt(deadline, std::move(callback));
+    }
+
+    TimingWheel::TimerId TimingWheel::scheduleAt(uint64_t deadline, Callback callback) {
+        if (!callback) throw std::invalid_argument("TimingWheel callback is empty.");
+
+        uint32_t id;
+        if (freeHead_ != kNil) {
+            id = freeHead_;
+            freeHead_ = timers_[id].next;
+        } else {
+            if (timers_.size() >= kNil) throw std::length_error("TimingWheel timer limit reached.");
+            id = static_cast<uint32_t>(timers_.size());
+            timers_.emplace_back();
+        }
+
+        Timer& timer = timers_[id];
+        // The current tick has already been processed.
+        timer.expiry = deadline > now_ ? deadline : now_ + 1;
+        timer.callback = std::move(callback);
+        timer.active = true;
+        link(id);
+        ++count_;
+        return TimerId(id, timer.generation);
+    }
+
+    bool TimingWheel::cancel(TimerId id) {
+        if (!isPending(id)) return false;
+        unlink(id.index);
+        release(id.index);
+        return true;
+    }
+
+    bool TimingWheel::isPending(TimerId id) const {
+        return id.index < timers_.size()
+            && timers_[id.index].active
+            && timers_[id.index].generation == id.generation;
+    }
+
+    // Advancing the clock
+    uint64_t TimingWheel::nextEventTick() const {
+        uint64_t best = UINT64_MAX;
+        for (size_t level = 0; level < kLevels; ++level) {
+            uint64_t bits = occupied_[level];
+            if (!bits) continue;
+
+            // Occupied slots always lie ahead of the current digit on their level.
+            size_t shift = level * kSlotBits;
+            size_t digit = (now_ >> shift) & kSlotMask;
+            bits &= digit == kSlotMask ? 0 : ~uint64_t{0} << (digit + 1);
+            if (!bits) continue;
+
+            size_t upper = shift + kSlotBits;
+            uint64_t base = upper >= 64 ? 0 : (now_ >> upper) << upper;
+            best = std::min(best, base + (uint64_t{lowestBit(bits)} << shift));
+        }
+        return best;
+    }
+
+    void TimingWheel::cascade(size_t slot) {
+        uint32_t id = heads_[slot];
+        if (id == kNil) return;
+        heads_[slot] = kNil;
+        occupied_[slot / kSlots] &= ~(uint64_t{1} << (slot % kSlots));
+
+        while (id != kNil) {
+            uint32_t next = timers_[id].next;
+            link(id);
+            id = next;
+        }
+    }
+
+    size_t TimingWheel::fireSlot(size_t index, std::exception_ptr& error) {
+        uint32_t id = heads_[index];
+        if (id == kNil) return 0;
+        heads_[index] = kNil;
+        occupied_[0] &= ~(uint64_t{1} << index);
+
+        // Detach the whole batch before running anything, so callbacks are free
+        // to schedule into this slot or recycle these records.
+        while (id != kNil) {
+            uint32_t next = timers_[id].next;
+            batch_.push_back(std::move(timers_[id].callback));
+            release(id);
+            id = next;
+        }
+
+        firing_ = true;
+        for (Callback& callback : batch_) {
+            try {
+                callback();
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+        firing_ = false;
+
+        size_t fired = batch_.size();
+        batch_.clear();
+        return fired;
+    }
+
+    size_t TimingWheel::advance(uint64_t now) {
+        if (firing_) throw std::logic_error("TimingWheel::advance called from a timer callback.");
+
+        size_t fired = 0;
+        std::exception_ptr error;
+        while (now_ < now) {
+            uint64_t tick = count_ == 0 ? UINT64_MAX : nextEventTick();
+            if (tick > now) {
+                now_ = now;
+                break;
+            }
+            now_ = tick;
+
+            // Highest level first: a timer cascading from level k may land in
+            // the level k-1 slot that also starts on this tick.
+            for (size_t level = kLevels - 1; level > 0; --level) {
+                size_t shift = level * kSlotBits;
+                if (now_ & ((uint64_t{1} << shift) - 1)) continue;
+                cascade(level * kSlots + ((now_ >> shift) & kSlotMask));
+            }
+            fired += fireSlot(now_ & kSlotMask, error);
+        }
+
+        if (error) std::rethrow_exception(error);
+        return fired;
+    }
+
+    // Accessors
+    uint64_t TimingWheel::now() const {
+        return now_;
+    }
+
+    size_t TimingWheel::size() const {
+        return count_;
+    }
+
+    bool TimingWheel::isEmpty() const {
+        return count_ == 0;
+    }
+
+    void TimingWheel::reserve(size_t n) {
+        timers_.reserve(n);
+    }
+
+} // namespace dsa
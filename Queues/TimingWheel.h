@@ -0,0 +1,146 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief A hierarchical timing wheel for very large numbers of timers.
+     *
+     * Time is an integer tick count. The wheel has kLevels levels of kSlots
+     * slots each; a timer lives on the level of the highest base-kSlots digit in
+     * which its deadline differs from the current tick, in the slot named by
+     * that digit. When the clock reaches the start of a higher-level slot, its
+     * timers are cascaded down and re-filed with finer resolution, and level-0
+     * slots fire. Eleven 64-slot levels cover the full 64-bit tick range.
+     *
+     * Timers are records in one vector, linked into their slot through indices
+     * (an intrusive doubly-linked list), so schedule() and cancel() are O(1)
+     * and allocation-free once the vector has grown. Each level keeps a 64-bit
+     * occupancy mask, so advance() jumps straight to the next tick with work
+     * instead of stepping through empty ticks: its cost is O(kLevels) per
+     * occupied slot visited plus the callbacks run, whatever the gap.
+     *
+     * Timers due on the same tick are detached first and then run as a batch.
+     * A callback may schedule or cancel timers; cancelling a timer from the
+     * same batch returns false, since it has already fired. Callbacks must not
+     * call advance().
+     */
+    class TimingWheel {
+    public:
+        using Callback = std::function<void()>;
+
+        static constexpr size_t kSlotBits = 6;
+        static constexpr size_t kSlots    = size_t{1} << kSlotBits;
+        static constexpr size_t kLevels   = (64 + kSlotBits - 1) / kSlotBits;
+
+        /**
+         * @brief Identifies a scheduled timer. Stale ids (fired, cancelled, or
+         * default-constructed) are detected by a generation count, so a recycled
+         * timer record is never cancelled through an old id.
+         */
+        class TimerId {
+        public:
+            TimerId() = default;
+        private:
+            friend class TimingWheel;
+            TimerId(uint32_t i, uint32_t g) : index(i), generation(g) {}
+            uint32_t index      = UINT32_MAX;
+            uint32_t generation = 0;
+        };
+
+        /**
+         * @brief Constructs an empty wheel.
+         * @param now The current tick.
+         */
+        explicit TimingWheel(uint64_t now = 0);
+
+        TimingWheel(const TimingWheel&) = delete;
+        TimingWheel& operator=(const TimingWheel&) = delete;
+
+        /**
+         * @brief Schedules a callback `delay` ticks from now. O(1).
+         * A delay of 0 fires on the next tick.
+         * @throws std::invalid_argument if callback is empty.
+         */
+        TimerId schedule(uint64_t delay, Callback callback);
+
+        /**
+         * @brief Schedules a callback at an absolute tick. O(1).
+         * Deadlines not after now() fire on the next tick.
+         * @throws std::invalid_argument if callback is empty.
+         */
+        TimerId scheduleAt(uint64_t deadline, Callback callback);
+
+        /**
+         * @brief Cancels a pending timer. O(1).
+         * @return true if the timer was pending; false if it already fired or was cancelled.
+         */
+        bool cancel(TimerId id);
+
+        /// @brief Checks if a timer is still waiting to fire. O(1).
+        bool isPending(TimerId id) const;
+
+        /**
+         * @brief Moves the clock forward, firing every timer due at or before `now`.
+         * Does nothing if `now` is not after the current tick. If callbacks throw,
+         * the remaining timers still fire and the first exception is rethrown.
+         * @return The number of callbacks run.
+         * @throws std::logic_error if called from inside a timer callback.
+         */
+        size_t advance(uint64_t now);
+
+        /// @brief Returns the current tick. O(1).
+        uint64_t now() const;
+
+        /// @brief Returns the number of pending timers. O(1).
+        size_t size() const;
+
+        /// @brief Checks if no timers are pending. O(1).
+        bool isEmpty() const;
+
+        /// @brief Pre-allocates records for n timers.
+        void reserve(size_t n);
+
+    private:
+        static constexpr uint32_t kNil      = UINT32_MAX;
+        static constexpr uint64_t kSlotMask = kSlots - 1;
+
+        /// @brief A timer record; `next` doubles as the free-list link.
+        struct Timer {
+            uint64_t expiry     = 0;
+            Callback callback;
+            uint32_t prev       = kNil;
+            uint32_t next       = kNil;
+            uint32_t generation = 0;
+            uint16_t slot       = 0;     // level * kSlots + index
+            bool     active     = false;
+        };
+
+        std::vector<Timer>    timers_;
+        uint32_t              freeHead_ = kNil;
+        uint32_t              heads_[kLevels * kSlots];
+        uint64_t              occupied_[kLevels] = {};   // Bit i set iff slot i is non-empty.
+        uint64_t              now_;
+        size_t                count_ = 0;
+        std::vector<Callback> batch_;                    // Reused across ticks.
+        bool                  firing_ = false;
+
+        /// @brief Files a timer into the slot for its expiry relative to now_.
+        void link(uint32_t id);
+        /// @brief Removes a timer from its slot.
+        void unlink(uint32_t id);
+        /// @brief Returns a record to the free list and invalidates its ids.
+        void release(uint32_t id);
+        /// @brief Returns the first tick after now_ at which some slot needs processing.
+        uint64_t nextEventTick() const;
+        /// @brief Re-files every timer in a higher-level slot.
+        void cascade(size_t slot);
+        /// @brief Runs the level-0 slot for now_; records the first exception thrown.
+        size_t fireSlot(size_t index, std::exception_ptr& error);
+    };
+
+} // namespace dsa
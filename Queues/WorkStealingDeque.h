@@ -0,0 +1,103 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace dsa {
+    /**
+     * @brief A lock-free Chase-Lev work-stealing deque.
+     *
+     * This is the concurrent counterpart of dsa::Deque used for task scheduling.
+     * A single owner thread pushes and pops at the bottom (LIFO, cache-warm work),
+     * while any number of thief threads steal from the top (FIFO, oldest work).
+     * The owner only contends with thieves when one element is left.
+     *
+     * Elements live in a growable circular array. When the owner runs out of room
+     * it copies the live range into a buffer twice as large; retired buffers are
+     * kept until the deque is destroyed since a thief may still be reading them.
+     *
+     * @tparam T The element type. Must be trivially copyable (typically a pointer
+     *           to a task), because slots are read and written atomically.
+     */
+    template<typename T>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "WorkStealingDeque elements must be trivially copyable.");
+
+    private:
+        /**
+         * @brief A fixed-size circular array of atomic slots.
+         */
+        struct Buffer {
+            int64_t capacity;                         // Always a power of two.
+            int64_t mask;                             // capacity - 1
+            std::unique_ptr<std::atomic<T>[]> slots;  // The circular storage.
+
+            explicit Buffer(int64_t cap);
+
+            T load(int64_t i) const;
+            void store(int64_t i, T value);
+            /// @brief Returns a buffer twice the size holding elements [top, bottom).
+            Buffer* grow(int64_t top, int64_t bottom) const;
+        };
+
+        alignas(64) std::atomic<int64_t> top_;       // Next index thieves steal from.
+        alignas(64) std::atomic<int64_t> bottom_;    // Next index the owner pushes to.
+        alignas(64) std::atomic<Buffer*> buffer_;    // The active buffer.
+        std::vector<std::unique_ptr<Buffer>> retired_; // Owner-only: every buffer ever allocated.
+
+    public:
+        /**
+         * @brief Constructs an empty deque.
+         * @param initialCapacity Initial slot count, rounded up to a power of two.
+         */
+        explicit WorkStealingDeque(size_t initialCapacity = 64);
+        ~WorkStealingDeque() = default;
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        /**
+         * @brief (Owner only) Pushes an element onto the bottom. Amortized O(1).
+         * @param value The value to push.
+         */
+        void pushBottom(T value);
+
+        /**
+         * @brief (Owner only) Pops the most recently pushed element. O(1).
+         * @return The element, or std::nullopt if the deque is empty or the last
+         *         element was taken by a concurrent thief.
+         */
+        std::optional<T> popBottom();
+
+        /**
+         * @brief (Any thread) Steals the oldest element from the top. O(1).
+         * @return The element, or std::nullopt if the deque is empty or another
+         *         thread won the race for it.
+         */
+        std::optional<T> steal();
+
+        /**
+         * @brief Checks if the deque is empty. O(1).
+         * Note: The answer may be stale by the time it is used when other threads
+         * are pushing or stealing concurrently.
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Returns an estimate of the number of elements. O(1).
+         * Note: Exact only when no other thread is operating on the deque.
+         */
+        size_t size() const;
+
+        /// @brief Returns the capacity of the active buffer. O(1).
+        size_t capacity() const;
+    };
+
+} // namespace dsa
+
+#include "WorkStealingDeque.tpp"
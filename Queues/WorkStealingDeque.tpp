@@ -0,0 +1,120 @@
+namespace dsa {
+
+    // Buffer
+    template<typename T>
+    WorkStealingDeque<T>::Buffer::Buffer(int64_t cap)
+        : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+    template<typename T>
+    T WorkStealingDeque<T>::Buffer::load(int64_t i) const {
+        return slots[i & mask].load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::Buffer::store(int64_t i, T value) {
+        slots[i & mask].store(value, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    typename WorkStealingDeque<T>::Buffer*
+    WorkStealingDeque<T>::Buffer::grow(int64_t top, int64_t bottom) const {
+        Buffer* bigger = new Buffer(capacity * 2);
+        for (int64_t i = top; i < bottom; ++i) {
+            bigger->store(i, load(i));
+        }
+        return bigger;
+    }
+
+    // Constructor
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(size_t initialCapacity) : top_(0), bottom_(0) {
+        int64_t cap = 1;
+        while (cap < static_cast<int64_t>(initialCapacity)) cap <<= 1;
+
+        retired_.emplace_back(new Buffer(cap));
+        buffer_.store(retired_.back().get(), std::memory_order_relaxed);
+    }
+
+    // Owner operations
+    template<typename T>
+    void WorkStealingDeque<T>::pushBottom(T value) {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        Buffer* buf = buffer_.load(std::memory_order_relaxed);
+
+        if (b - t > buf->capacity - 1) {
+            // Full: publish a larger copy. Thieves holding the old buffer still
+            // read valid data from it, so it is retired rather than freed.
+            retired_.emplace_back(buf->grow(t, b));
+            buf = retired_.back().get();
+            buffer_.store(buf, std::memory_order_release);
+        }
+
+        buf->store(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    std::optional<T> WorkStealingDeque<T>::popBottom() {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buf = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Already empty: restore bottom.
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<T> result = buf->load(b);
+        if (t == b) {
+            // Last element: race the thieves for it.
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                              std::memory_order_relaxed)) {
+                result = std::nullopt;
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    // Thief operations
+    template<typename T>
+    std::optional<T> WorkStealingDeque<T>::steal() {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+
+        if (t >= b) return std::nullopt;
+
+        Buffer* buf = buffer_.load(std::memory_order_acquire);
+        T value = buf->load(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return std::nullopt; // Lost the race to another thief or the owner.
+        }
+        return value;
+    }
+
+    // Accessors
+    template<typename T>
+    bool WorkStealingDeque<T>::isEmpty() const {
+        return size() == 0;
+    }
+
+    template<typename T>
+    size_t WorkStealingDeque<T>::size() const {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    template<typename T>
+    size_t WorkStealingDeque<T>::capacity() const {
+        return static_cast<size_t>(buffer_.load(std::memory_order_relaxed)->capacity);
+    }
+
+} // namespace dsa
@@ -1,6 +1,10 @@
 #include <iostream>
 #include "Queue.h"
 #include "Deque.h"
+#include "ThreadPool.h"
+#include "PriorityQueue.h"
+#include "TimingWheel.h"
+#include <atomic>
 
 using namespace dsa;
 
@@ -40,5 +44,35 @@ int main() {
     std::cout << "New Front: " << deque.peekFront() << "\n";  // 63
     std::cout << "Length: " << deque.getLength() << "\n";
 
+    // PRIORITY QUEUE (4-ary min-heap)
+    std::vector<int> values = {42, 7, 19, 3, 25};
+    PriorityQueue<int, std::less<int>, 4> pq(values.begin(), values.end());
+
+    std::cout << "Heap order:";
+    while (!pq.isEmpty()) {
+        std::cout << " " << pq.top();  // 3 7 19 25 42
+        pq.pop();
+    }
+    std::cout << "\n";
+
+    // THREAD POOL (work-stealing)
+    ThreadPool pool(4);
+    std::atomic<int> sum{0};
+
+    for (int i = 1; i <= 100; ++i) {
+        pool.submit([&sum, i] { sum.fetch_add(i); });
+    }
+    pool.wait();
+    std::cout << "Parallel sum 1..100: " << sum.load() << "\n";  // 5050
+
+    // TIMING WHEEL
+    TimingWheel wheel;
+    auto timeout = wheel.schedule(30, [] { std::cout << "Connection timed out\n"; });
+    wheel.schedule(10, [] { std::cout << "Tick 10 fired\n"; });
+    wheel.cancel(timeout);  // connection saw activity
+
+    size_t fired = wheel.advance(100);
+    std::cout << "Timers fired: " << fired << "\n";  // 1
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "BlockingQueue.h"
+
+using namespace dsa;
+using namespace std::chrono_literals;
+
+TEST(BlockingQueueTest, FifoOrder) {
+    BlockingQueue<int> q(4);
+    EXPECT_TRUE(q.enqueue(1));
+    EXPECT_TRUE(q.enqueue(2));
+    EXPECT_EQ(q.size(), 2u);
+
+    int v = 0;
+    EXPECT_TRUE(q.dequeue(v));
+    EXPECT_EQ(v, 1);
+    EXPECT_TRUE(q.tryDequeue(v));
+    EXPECT_EQ(v, 2);
+    EXPECT_FALSE(q.tryDequeue(v));
+    EXPECT_TRUE(q.isEmpty());
+}
+
+TEST(BlockingQueueTest, CapacityBound) {
+    BlockingQueue<int> q(2);
+    EXPECT_TRUE(q.tryEnqueue(1));
+    EXPECT_TRUE(q.tryEnqueue(2));
+    EXPECT_FALSE(q.tryEnqueue(3));
+    EXPECT_FALSE(q.enqueue(3, 10ms));
+    EXPECT_EQ(q.size(), 2u);
+
+    EXPECT_THROW(BlockingQueue<int>(0), std::invalid_argument);
+}
+
+TEST(BlockingQueueTest, ProducerBlocksUntilSpace) {
+    BlockingQueue<int> q(1);
+    q.enqueue(1);
+
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        q.enqueue(2); // blocks until the consumer makes room
+        done.store(true);
+    });
+
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(done.load());
+
+    int v = 0;
+    q.dequeue(v);
+    producer.join();
+    EXPECT_TRUE(done.load());
+    q.dequeue(v);
+    EXPECT_EQ(v, 2);
+}
+
+TEST(BlockingQueueTest, DequeueBatch) {
+    BlockingQueue<int> q(16);
+    for (int i = 0; i < 10; ++i) q.enqueue(i);
+
+    std::vector<int> out;
+    EXPECT_EQ(q.dequeueBatch(out, 4, 0ms), 4u);
+    EXPECT_EQ(q.dequeueBatch(out, 100, 0ms), 6u);
+    EXPECT_EQ(out, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    EXPECT_EQ(q.dequeueBatch(out, 4, 5ms), 0u); // times out empty
+}
+
+TEST(BlockingQueueTest, CloseDrainsThenStops) {
+    BlockingQueue<int> q(4);
+    q.enqueue(7);
+    q.close();
+
+    EXPECT_TRUE(q.isClosed());
+    EXPECT_FALSE(q.enqueue(8));
+    EXPECT_FALSE(q.tryEnqueue(8));
+
+    int v = 0;
+    EXPECT_TRUE(q.dequeue(v));
+    EXPECT_EQ(v, 7);
+    EXPECT_FALSE(q.dequeue(v));
+}
+
+TEST(BlockingQueueTest, CloseWakesBlockedConsumer) {
+    BlockingQueue<int> q(4);
+    std::thread consumer([&] {
+        int v = 0;
+        EXPECT_FALSE(q.dequeue(v));
+    });
+    std::this_thread::sleep_for(10ms);
+    q.close();
+    consumer.join();
+}
+
+TEST(BlockingQueueTest, ManyProducersBatchConsumer) {
+    constexpr int producers = 4;
+    constexpr int perProducer = 5000;
+    BlockingQueue<int> q(64);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q] {
+            for (int i = 0; i < perProducer; ++i) q.enqueue(1);
+        });
+    }
+
+    long long total = 0;
+    std::vector<int> batch;
+    while (total < producers * perProducer) {
+        batch.clear();
+        q.dequeueBatch(batch, 256, 100ms);
+        for (int v : batch) total += v;
+    }
+    for (auto& t : threads) t.join();
+
+    EXPECT_EQ(total, producers * perProducer);
+    EXPECT_TRUE(q.isEmpty());
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "Channel.h"
+
+using namespace dsa;
+
+namespace {
+    // Coroutines are free functions: lambda captures would not outlive the
+    // first suspension.
+    AsyncTask produce(Channel<int>& ch, int from, int to, bool closeWhenDone) {
+        for (int i = from; i < to; ++i) {
+            if (!co_await ch.send(i)) co_return;
+        }
+        if (closeWhenDone) ch.close();
+    }
+
+    AsyncTask collect(Channel<int>& ch, std::vector<int>& out) {
+        while (auto value = co_await ch.receive()) out.push_back(*value);
+    }
+
+    AsyncTask sendOne(Channel<int>& ch, int value, int& result) {
+        result = (co_await ch.send(value)) ? 1 : 0;
+    }
+
+    AsyncTask receiveOne(Channel<int>& ch, std::optional<int>& out, bool& done) {
+        out = co_await ch.receive();
+        done = true;
+    }
+
+    AsyncTask failing() {
+        throw std::runtime_error("stream failed");
+        co_return;
+    }
+
+    AsyncTask produceAndSignal(Channel<int>& ch, int from, int to, std::atomic<int>& producersLeft) {
+        for (int i = from; i < to; ++i) co_await ch.send(i);
+        if (producersLeft.fetch_sub(1) == 1) ch.close();
+    }
+
+    AsyncTask sum(Channel<int>& ch, std::atomic<long long>& total, std::atomic<int>& received) {
+        while (auto value = co_await ch.receive()) {
+            total.fetch_add(*value);
+            received.fetch_add(1);
+        }
+    }
+}
+
+TEST(ChannelTest, BufferedPreservesOrder) {
+    SingleThreadExecutor executor;
+    Channel<int> ch(executor, 4);
+    std::vector<int> got;
+
+    executor.spawn(collect(ch, got));
+    executor.spawn(produce(ch, 0, 100, true));
+    executor.run();
+
+    ASSERT_EQ(got.size(), 100u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(got[i], i);
+    EXPECT_EQ(ch.size(), 0u);
+}
+
+TEST(ChannelTest, RendezvousHandsOffDirectly) {
+    SingleThreadExecutor executor;
+    Channel<int> ch(executor, 0);
+    int result = -1;
+
+    executor.spawn(sendOne(ch, 7, result));
+    executor.run();
+    EXPECT_EQ(result, -1);       // no receiver yet: the sender is suspended
+    EXPECT_EQ(ch.size(), 0u);
+
+    EXPECT_EQ(ch.tryReceive(), 7);
+    executor.run();
+    EXPECT_EQ(result, 1);
+}
+
+TEST(ChannelTest, CloseWakesWaiters) {
+    SingleThreadExecutor executor;
+    Channel<int> empty(executor, 1);
+    Channel<int> full(executor, 1);
+    std::optional<int> received = 42;
+    bool done = false;
+    int sent = -1;
+
+    ASSERT_TRUE(full.trySend(1));
+    executor.spawn(receiveOne(empty, received, done));
+    executor.spawn(sendOne(full, 2, sent));
+    executor.run();
+    EXPECT_FALSE(done);
+    EXPECT_EQ(sent, -1);
+
+    empty.close();
+    full.close();
+    executor.run();
+    EXPECT_TRUE(done);
+    EXPECT_FALSE(received.has_value());
+    EXPECT_EQ(sent, 0);
+
+    // Buffered items survive close; further sends fail.
+    EXPECT_EQ(full.tryReceive(), 1);
+    EXPECT_FALSE(full.trySend(3));
+}
+
+TEST(ChannelTest, ManyStreamsOnOneThread) {
+    SingleThreadExecutor executor;
+    Channel<int> ch(executor, 8);
+    std::vector<int> got;
+    std::atomic<int> producersLeft{1000};
+
+    executor.spawn(collect(ch, got));
+    for (int s = 0; s < 1000; ++s) executor.spawn(produceAndSignal(ch, s * 10, s * 10 + 10, producersLeft));
+    executor.run();
+
+    ASSERT_EQ(got.size(), 10000u);
+    long long total = 0;
+    for (int v : got) total += v;
+    EXPECT_EQ(total, 9999LL * 10000 / 2);
+}
+
+TEST(ChannelTest, ThreadPoolExecutorManyProducersAndConsumers) {
+    ThreadPoolExecutor executor(4);
+    Channel<int> ch(executor, 16);
+    std::atomic<long long> total{0};
+    std::atomic<int> received{0};
+    std::atomic<int> producersLeft{8};
+
+    for (int c = 0; c < 4; ++c) executor.spawn(sum(ch, total, received));
+    for (int p = 0; p < 8; ++p) executor.spawn(produceAndSignal(ch, p * 5000, p * 5000 + 5000, producersLeft));
+    executor.wait();
+
+    EXPECT_EQ(received.load(), 40000);
+    EXPECT_EQ(total.load(), 39999LL * 40000 / 2);
+    EXPECT_TRUE(ch.isClosed());
+}
+
+TEST(ChannelTest, ExceptionsReachTheExecutor) {
+    SingleThreadExecutor executor;
+    executor.spawn(failing());
+    EXPECT_THROW(executor.run(), std::runtime_error);
+    EXPECT_NO_THROW(executor.run());
+}
@@ -43,4 +43,16 @@ TEST(DequeTest, Exceptions) {
     EXPECT_THROW(dq.popBack(), std::runtime_error);
     EXPECT_THROW(dq.peekFront(), std::runtime_error);
     EXPECT_THROW(dq.peekBack(), std::runtime_error);
+}
+
+TEST(DequeTest, PopBackWithDuplicates) {
+    Deque<int> dq;
+    dq.pushBack(1);
+    dq.pushBack(2);
+    dq.pushBack(1);
+
+    EXPECT_EQ(dq.popBack(), 1);
+    EXPECT_EQ(dq.peekFront(), 1);
+    EXPECT_EQ(dq.peekBack(), 2);
+    EXPECT_EQ(dq.getLength(), 2);
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "IndexedPriorityQueue.h"
+
+using namespace dsa;
+
+TEST(IndexedPriorityQueueTest, PushTopPop) {
+    IndexedPriorityQueue<int> pq(5);
+    pq.push(0, 50);
+    pq.push(1, 10);
+    pq.push(2, 30);
+
+    EXPECT_EQ(pq.top(), 1u);
+    EXPECT_EQ(pq.topKey(), 10);
+    pq.pop();
+    EXPECT_EQ(pq.top(), 2u);
+    EXPECT_FALSE(pq.contains(1));
+    EXPECT_EQ(pq.size(), 2u);
+}
+
+TEST(IndexedPriorityQueueTest, DecreaseKeyMovesToTop) {
+    IndexedPriorityQueue<int> pq(4);
+    pq.push(0, 40);
+    pq.push(1, 30);
+    pq.push(2, 20);
+    pq.push(3, 10);
+
+    pq.decreaseKey(0, 5);
+    EXPECT_EQ(pq.top(), 0u);
+    EXPECT_EQ(pq.keyOf(0), 5);
+
+    EXPECT_THROW(pq.decreaseKey(1, 35), std::invalid_argument); // would increase
+}
+
+TEST(IndexedPriorityQueueTest, UpdateAndErase) {
+    IndexedPriorityQueue<int, std::less<int>, 2> pq;
+    for (size_t id = 0; id < 10; ++id) pq.push(id, static_cast<int>(id));
+
+    pq.update(0, 100); // sinks to the bottom
+    EXPECT_EQ(pq.top(), 1u);
+
+    EXPECT_TRUE(pq.erase(1));
+    EXPECT_FALSE(pq.erase(1));
+    EXPECT_EQ(pq.top(), 2u);
+
+    std::vector<size_t> order;
+    while (!pq.isEmpty()) {
+        order.push_back(pq.top());
+        pq.pop();
+    }
+    EXPECT_EQ(order, (std::vector<size_t>{2, 3, 4, 5, 6, 7, 8, 9, 0}));
+}
+
+TEST(IndexedPriorityQueueTest, InvalidHandles) {
+    IndexedPriorityQueue<int> pq(2);
+    pq.push(0, 1);
+
+    EXPECT_THROW(pq.push(0, 2), std::invalid_argument);
+    EXPECT_THROW(pq.keyOf(1), std::invalid_argument);
+    EXPECT_THROW(pq.decreaseKey(7, 0), std::invalid_argument);
+
+    pq.clear();
+    EXPECT_TRUE(pq.isEmpty());
+    EXPECT_FALSE(pq.contains(0));
+    EXPECT_THROW(pq.top(), std::runtime_error);
+    EXPECT_THROW(pq.pop(), std::runtime_error);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include "MonotonicQueue.h"
+#include "SlidingWindowAggregator.h"
+
+using namespace dsa;
+
+TEST(MonotonicQueueTest, SlidingWindowMinimum) {
+    std::vector<int> values = {4, 2, 12, 3, 8, 2, 7, 7, 1, 9};
+    std::vector<int> expected = {2, 2, 3, 2, 2, 2, 1, 1};
+    MonotonicQueue<int> window;
+
+    std::vector<int> mins;
+    for (size_t i = 0; i < values.size(); ++i) {
+        window.push(values[i]);
+        if (window.size() > 3) window.pop();
+        if (window.size() == 3) mins.push_back(window.current());
+    }
+    EXPECT_EQ(mins, expected);
+}
+
+TEST(MonotonicQueueTest, MaximumWithDuplicates) {
+    MonotonicQueue<int, std::greater<int>> q;
+    q.push(5);
+    q.push(5);
+    q.push(1);
+    EXPECT_EQ(q.current(), 5);
+
+    q.pop();
+    EXPECT_EQ(q.current(), 5); // the second 5 is still in the window
+    q.pop();
+    EXPECT_EQ(q.current(), 1);
+    EXPECT_EQ(q.size(), 1);
+}
+
+TEST(MonotonicQueueTest, EmptyAndClear) {
+    MonotonicQueue<int> q;
+    EXPECT_TRUE(q.isEmpty());
+    EXPECT_THROW(q.pop(), std::runtime_error);
+    EXPECT_THROW(q.current(), std::runtime_error);
+
+    q.push(3);
+    q.push(1);
+    q.clear();
+    EXPECT_TRUE(q.isEmpty());
+    q.push(7);
+    EXPECT_EQ(q.current(), 7);
+}
+
+TEST(SlidingWindowAggregatorTest, SumMatchesBruteForce) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist(-50, 50);
+    SlidingWindowAggregator<long long> window;
+    std::vector<long long> mirror;
+
+    for (int step = 0; step < 2000; ++step) {
+        if (mirror.empty() || rng() % 3 != 0) {
+            long long v = dist(rng);
+            window.push(v);
+            mirror.push_back(v);
+        } else {
+            window.pop();
+            mirror.erase(mirror.begin());
+        }
+        ASSERT_EQ(window.size(), mirror.size());
+        if (!mirror.empty()) {
+            long long sum = 0;
+            for (long long v : mirror) sum += v;
+            ASSERT_EQ(window.query(), sum);
+        }
+    }
+}
+
+TEST(SlidingWindowAggregatorTest, NonCommutativeFoldKeepsOrder) {
+    auto concat = [](const std::string& a, const std::string& b) { return a + b; };
+    SlidingWindowAggregator<std::string, decltype(concat)> window(concat);
+
+    window.push("a");
+    window.push("b");
+    window.push("c");
+    EXPECT_EQ(window.query(), "abc");
+
+    window.pop();            // flips the back stack onto the front
+    window.push("d");
+    EXPECT_EQ(window.query(), "bcd");
+    window.pop();
+    window.pop();
+    EXPECT_EQ(window.query(), "d");
+}
+
+TEST(SlidingWindowAggregatorTest, MinOverWindow) {
+    auto minOp = [](int a, int b) { return std::min(a, b); };
+    SlidingWindowAggregator<int, decltype(minOp)> window(minOp);
+    window.push(3);
+    window.push(1);
+    window.push(4);
+    EXPECT_EQ(window.query(), 1);
+    window.pop();
+    window.pop();
+    EXPECT_EQ(window.query(), 4);
+}
+
+TEST(SlidingWindowAggregatorTest, Exceptions) {
+    SlidingWindowAggregator<int> window;
+    EXPECT_THROW(window.pop(), std::runtime_error);
+    EXPECT_THROW(window.query(), std::runtime_error);
+}
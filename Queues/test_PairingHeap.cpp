@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "PairingHeap.h"
+
+using namespace dsa;
+
+TEST(PairingHeapTest, PushPopInOrder) {
+    std::mt19937 rng(11);
+    std::vector<int> values(1000);
+    for (int& v : values) v = static_cast<int>(rng() % 5000);
+
+    PairingHeap<int> heap;
+    for (int v : values) heap.push(v);
+    std::sort(values.begin(), values.end());
+
+    EXPECT_EQ(heap.size(), values.size());
+    for (int expected : values) {
+        EXPECT_EQ(heap.top(), expected);
+        heap.pop();
+    }
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+TEST(PairingHeapTest, DecreaseKey) {
+    PairingHeap<int> heap;
+    heap.push(10);
+    auto h = heap.push(50);
+    heap.push(30);
+    heap.pop(); // forces 50 below the root
+
+    heap.decreaseKey(h, 5);
+    EXPECT_EQ(heap.top(), 5);
+    EXPECT_EQ(heap.valueOf(h), 5);
+    EXPECT_THROW(heap.decreaseKey(h, 99), std::invalid_argument);
+}
+
+TEST(PairingHeapTest, EraseArbitrary) {
+    PairingHeap<int> heap;
+    std::vector<PairingHeap<int>::Handle> handles;
+    for (int i = 0; i < 10; ++i) handles.push_back(heap.push(i));
+    heap.pop(); // 0; builds a non-trivial tree
+
+    heap.erase(handles[5]);
+    heap.erase(handles[1]); // current root
+    std::vector<int> order;
+    while (!heap.isEmpty()) {
+        order.push_back(heap.top());
+        heap.pop();
+    }
+    EXPECT_EQ(order, (std::vector<int>{2, 3, 4, 6, 7, 8, 9}));
+}
+
+TEST(PairingHeapTest, MeldKeepsHandlesValid) {
+    PairingHeap<int> a, b;
+    a.push(4);
+    a.push(8);
+    auto h = b.push(20);
+    b.push(1);
+
+    a.meld(b);
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_EQ(a.size(), 4u);
+    EXPECT_EQ(a.top(), 1);
+
+    a.decreaseKey(h, 0); // handle obtained from b
+    EXPECT_EQ(a.top(), 0);
+
+    // b stays usable after being melded away.
+    b.push(7);
+    EXPECT_EQ(b.top(), 7);
+}
+
+TEST(PairingHeapTest, MeldManyShards) {
+    PairingHeap<int> global;
+    for (int shard = 0; shard < 8; ++shard) {
+        PairingHeap<int> local;
+        for (int i = 0; i < 100; ++i) local.push(i * 8 + shard);
+        global.meld(local);
+    }
+
+    EXPECT_EQ(global.size(), 800u);
+    for (int expected = 0; expected < 800; ++expected) {
+        EXPECT_EQ(global.top(), expected);
+        global.pop();
+    }
+}
+
+TEST(PairingHeapTest, RepeatedMeldWithSharedPoolStaysBounded) {
+    PairingHeap<int>::Pool pool;
+    PairingHeap<int> global(pool);
+    std::vector<PairingHeap<int>> shards;
+    for (int s = 0; s < 4; ++s) shards.emplace_back(pool);
+
+    for (int tick = 0; tick < 5000; ++tick) {
+        for (int s = 0; s < 4; ++s) {
+            for (int i = 0; i < 8; ++i) shards[s].push(tick + i * 4 + s);
+            global.meld(shards[s]);
+        }
+        ASSERT_EQ(global.size(), 32u);
+        for (int expected = tick; !global.isEmpty(); ++expected) {
+            EXPECT_EQ(global.top(), expected);
+            global.pop();
+        }
+    }
+    // At most 32 nodes are ever live, so one chunk serves every tick.
+    EXPECT_EQ(pool.chunkCount(), 1u);
+    EXPECT_EQ(pool.liveCount(), 0u);
+}
+
+TEST(PairingHeapTest, MeldAcrossSharedPools) {
+    PairingHeap<int>::Pool poolA, poolB;
+    PairingHeap<int> a(poolA), b(poolB), owned;
+    a.push(3);
+    b.push(1);
+    owned.push(2);
+
+    EXPECT_THROW(a.meld(b), std::invalid_argument);
+    EXPECT_EQ(b.size(), 1u);
+
+    a.meld(owned); // an owned pool is absorbed into the shared one
+    EXPECT_EQ(a.top(), 2);
+    EXPECT_EQ(poolA.liveCount(), 2u);
+}
+
+TEST(PairingHeapTest, EmptyThrows) {
+    PairingHeap<int> heap;
+    EXPECT_THROW(heap.top(), std::runtime_error);
+    EXPECT_THROW(heap.pop(), std::runtime_error);
+    EXPECT_THROW(heap.erase(PairingHeap<int>::Handle()), std::invalid_argument);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "PriorityQueue.h"
+
+using namespace dsa;
+
+// ---------- Shared Typed Test Suite ----------
+
+template <typename T>
+class PriorityQueueTest : public ::testing::Test {
+public:
+    T pq;
+};
+
+TYPED_TEST_SUITE_P(PriorityQueueTest);
+
+TYPED_TEST_P(PriorityQueueTest, PushAndTop) {
+    this->pq.push(5);
+    this->pq.push(1);
+    this->pq.push(3);
+
+    EXPECT_EQ(this->pq.top(), 1);
+    EXPECT_EQ(this->pq.size(), 3u);
+    EXPECT_FALSE(this->pq.isEmpty());
+}
+
+TYPED_TEST_P(PriorityQueueTest, PopsInSortedOrder) {
+    std::mt19937 rng(42);
+    std::vector<int> values(500);
+    for (int& v : values) v = static_cast<int>(rng() % 1000);
+
+    for (int v : values) this->pq.push(v);
+    std::sort(values.begin(), values.end());
+
+    for (int expected : values) {
+        EXPECT_EQ(this->pq.top(), expected);
+        this->pq.pop();
+    }
+    EXPECT_TRUE(this->pq.isEmpty());
+}
+
+TYPED_TEST_P(PriorityQueueTest, HeapifyFromRange) {
+    std::vector<int> values = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+    this->pq.push(-100); // replaced by heapify
+    this->pq.heapify(values.begin(), values.end());
+
+    EXPECT_EQ(this->pq.size(), values.size());
+    for (int expected = 0; expected < 10; ++expected) {
+        EXPECT_EQ(this->pq.top(), expected);
+        this->pq.pop();
+    }
+}
+
+TYPED_TEST_P(PriorityQueueTest, EmptyThrows) {
+    EXPECT_THROW(this->pq.top(), std::runtime_error);
+    EXPECT_THROW(this->pq.pop(), std::runtime_error);
+
+    this->pq.push(1);
+    this->pq.clear();
+    EXPECT_TRUE(this->pq.isEmpty());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+    PriorityQueueTest,
+    PushAndTop,
+    PopsInSortedOrder,
+    HeapifyFromRange,
+    EmptyThrows
+);
+
+// ---------- Plug in All Arities ----------
+
+using PriorityQueueTypes = ::testing::Types<
+    PriorityQueue<int, std::less<int>, 2>,
+    PriorityQueue<int, std::less<int>, 4>,
+    PriorityQueue<int, std::less<int>, 8>
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(
+    AllArities,
+    PriorityQueueTest,
+    PriorityQueueTypes
+);
+
+TEST(PriorityQueueTest, MaxHeapWithGreater) {
+    std::vector<int> values = {3, 1, 4, 1, 5, 9, 2, 6};
+    PriorityQueue<int, std::greater<int>> pq(values.begin(), values.end());
+
+    EXPECT_EQ(pq.top(), 9);
+    pq.pop();
+    EXPECT_EQ(pq.top(), 6);
+}
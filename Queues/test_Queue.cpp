@@ -48,4 +48,17 @@ TEST(QueueTest, UnderflowThrows) {
     EXPECT_THROW(q.front(), std::runtime_error);
     EXPECT_THROW(q.back(), std::runtime_error);
     EXPECT_THROW(q.dequeue(), std::runtime_error);
+}
+
+TEST(QueueTest, ReuseAfterDrained) {
+    Queue<int> q;
+    q.enqueue(1);
+    q.dequeue();
+    EXPECT_TRUE(q.isEmpty());
+
+    q.enqueue(2);
+    q.enqueue(3);
+    EXPECT_EQ(q.front(), 2);
+    EXPECT_EQ(q.back(), 3);
+    EXPECT_EQ(q.size(), 2);
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "RadixHeap.h"
+#include "BucketQueue.h"
+
+using namespace dsa;
+
+// ---------- Shared Typed Test Suite ----------
+
+template <typename T>
+class MonotoneQueueTest : public ::testing::Test {
+public:
+    T pq{16};
+};
+
+TYPED_TEST_SUITE_P(MonotoneQueueTest);
+
+TYPED_TEST_P(MonotoneQueueTest, PopsInKeyOrder) {
+    this->pq.push(0, 30);
+    this->pq.push(1, 10);
+    this->pq.push(2, 20);
+    this->pq.push(3, 10);
+
+    EXPECT_EQ(this->pq.topKey(), 10);
+    this->pq.pop();
+    EXPECT_EQ(this->pq.topKey(), 10);
+    this->pq.pop();
+    EXPECT_EQ(this->pq.top(), 2u);
+    this->pq.pop();
+    EXPECT_EQ(this->pq.top(), 0u);
+    this->pq.pop();
+    EXPECT_TRUE(this->pq.isEmpty());
+}
+
+TYPED_TEST_P(MonotoneQueueTest, DecreaseKeyAndErase) {
+    this->pq.push(0, 50);
+    this->pq.push(1, 40);
+    this->pq.push(2, 1000);
+
+    this->pq.decreaseKey(2, 5);
+    EXPECT_EQ(this->pq.top(), 2u);
+    EXPECT_EQ(this->pq.keyOf(2), 5);
+
+    EXPECT_TRUE(this->pq.erase(2));
+    EXPECT_FALSE(this->pq.contains(2));
+    EXPECT_EQ(this->pq.top(), 1u);
+    EXPECT_EQ(this->pq.size(), 2u);
+}
+
+TYPED_TEST_P(MonotoneQueueTest, PushesBetweenBoundAndMinimumAreAllowed) {
+    // After popping key 0, key 3 is still legal even though 100 is queued.
+    this->pq.push(0, 0);
+    this->pq.push(1, 100);
+    EXPECT_EQ(this->pq.topKey(), 0);
+    this->pq.pop();
+
+    this->pq.push(2, 3);
+    EXPECT_EQ(this->pq.top(), 2u);
+    EXPECT_EQ(this->pq.topKey(), 3);
+}
+
+TYPED_TEST_P(MonotoneQueueTest, RejectsNonMonotoneKeys) {
+    this->pq.push(0, 10);
+    EXPECT_EQ(this->pq.topKey(), 10);
+    this->pq.pop();
+
+    EXPECT_THROW(this->pq.push(1, 9), std::invalid_argument);
+    EXPECT_THROW(this->pq.push(1, -1), std::invalid_argument);
+    this->pq.push(1, 12);
+    EXPECT_THROW(this->pq.push(1, 15), std::invalid_argument);   // duplicate id
+    EXPECT_THROW(this->pq.decreaseKey(1, 20), std::invalid_argument);
+}
+
+TYPED_TEST_P(MonotoneQueueTest, MatchesSortedOrderUnderDijkstraPattern) {
+    // Simulate Dijkstra: every push is last-popped key + small weight.
+    std::mt19937 rng(7);
+    std::vector<int> popped;
+    size_t nextId = 1;
+    this->pq.push(0, 0);
+
+    while (!this->pq.isEmpty() && nextId < 2000) {
+        int d = this->pq.topKey();
+        this->pq.pop();
+        popped.push_back(d);
+        for (int k = 0; k < 2; ++k) this->pq.push(nextId++, d + static_cast<int>(rng() % 300));
+    }
+    EXPECT_TRUE(std::is_sorted(popped.begin(), popped.end()));
+}
+
+TYPED_TEST_P(MonotoneQueueTest, EmptyThrows) {
+    EXPECT_THROW(this->pq.top(), std::runtime_error);
+    EXPECT_THROW(this->pq.topKey(), std::runtime_error);
+    EXPECT_THROW(this->pq.pop(), std::runtime_error);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(
+    MonotoneQueueTest,
+    PopsInKeyOrder,
+    DecreaseKeyAndErase,
+    PushesBetweenBoundAndMinimumAreAllowed,
+    RejectsNonMonotoneKeys,
+    MatchesSortedOrderUnderDijkstraPattern,
+    EmptyThrows
+);
+
+// ---------- Plug in All Monotone Queues ----------
+
+using MonotoneQueueTypes = ::testing::Types<
+    RadixHeap<int>,
+    BucketQueue<int>
+>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(
+    AllMonotoneQueues,
+    MonotoneQueueTest,
+    MonotoneQueueTypes
+);
+
+TEST(BucketQueueTest, WindowGrowsForWideKeys) {
+    BucketQueue<int> pq(4, 4);
+    pq.push(0, 0);
+    pq.push(1, 1000);
+    EXPECT_GE(pq.bucketCount(), 1001u);
+
+    EXPECT_EQ(pq.top(), 0u);
+    pq.pop();
+    EXPECT_EQ(pq.top(), 1u);
+}
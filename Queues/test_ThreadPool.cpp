@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include "ThreadPool.h"
+
+using namespace dsa;
+
+TEST(ThreadPoolTest, RunsAllSubmittedTasks) {
+    ThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    for (int i = 0; i < 1000; ++i) {
+        pool.submit([&counter] { counter.fetch_add(1); });
+    }
+    pool.wait();
+
+    EXPECT_EQ(counter.load(), 1000);
+    EXPECT_EQ(pool.threadCount(), 4u);
+}
+
+TEST(ThreadPoolTest, NestedTasksAreWaitedFor) {
+    ThreadPool pool(4);
+    std::atomic<int> leaves{0};
+
+    // Binary fan-out of depth 10 spawned from inside the workers.
+    std::function<void(int)> spawn = [&](int depth) {
+        if (depth == 0) {
+            leaves.fetch_add(1);
+            return;
+        }
+        pool.submit([&spawn, depth] { spawn(depth - 1); });
+        pool.submit([&spawn, depth] { spawn(depth - 1); });
+    };
+    pool.submit([&spawn] { spawn(10); });
+    pool.wait();
+
+    EXPECT_EQ(leaves.load(), 1024);
+}
+
+TEST(ThreadPoolTest, CurrentWorker) {
+    ThreadPool pool(2);
+    std::atomic<int> index{-2};
+
+    EXPECT_EQ(pool.currentWorker(), -1);
+    pool.submit([&] { index.store(pool.currentWorker()); });
+    pool.wait();
+
+    EXPECT_GE(index.load(), 0);
+    EXPECT_LT(index.load(), 2);
+}
+
+TEST(ThreadPoolTest, WaitRethrowsTaskException) {
+    ThreadPool pool(2);
+    pool.submit([] { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+
+    // The error is reported once; the pool keeps working afterwards.
+    std::atomic<bool> ran{false};
+    pool.submit([&ran] { ran.store(true); });
+    EXPECT_NO_THROW(pool.wait());
+    EXPECT_TRUE(ran.load());
+}
+
+TEST(ThreadPoolTest, WaitFromOwnTaskThrowsInsteadOfDeadlocking) {
+    ThreadPool pool(2);
+    pool.submit([&pool] { pool.wait(); });
+    EXPECT_THROW(pool.wait(), std::logic_error);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "TimingWheel.h"
+
+using namespace dsa;
+
+TEST(TimingWheelTest, FiresAtDeadline) {
+    TimingWheel wheel;
+    std::vector<int> fired;
+    wheel.schedule(5, [&] { fired.push_back(5); });
+    wheel.schedule(1, [&] { fired.push_back(1); });
+    wheel.schedule(70, [&] { fired.push_back(70); }); // starts on level 1
+
+    EXPECT_EQ(wheel.advance(4), 1);
+    EXPECT_EQ(fired, (std::vector<int>{1}));
+    EXPECT_EQ(wheel.advance(69), 1);
+    EXPECT_EQ(wheel.size(), 1);
+    EXPECT_EQ(wheel.advance(70), 1);
+    EXPECT_EQ(fired, (std::vector<int>{1, 5, 70}));
+    EXPECT_TRUE(wheel.isEmpty());
+    EXPECT_EQ(wheel.now(), 70);
+}
+
+TEST(TimingWheelTest, CancelAndStaleIds) {
+    TimingWheel wheel;
+    int count = 0;
+    auto a = wheel.schedule(10, [&] { ++count; });
+    auto b = wheel.schedule(10, [&] { ++count; });
+
+    EXPECT_TRUE(wheel.isPending(a));
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(TimingWheel::TimerId()));
+
+    // The cancelled record is recycled; the old id must not reach the new timer.
+    auto c = wheel.schedule(20, [&] { ++count; });
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_TRUE(wheel.isPending(c));
+
+    wheel.advance(100);
+    EXPECT_EQ(count, 2);
+    EXPECT_FALSE(wheel.isPending(b));
+    EXPECT_FALSE(wheel.cancel(c));
+}
+
+TEST(TimingWheelTest, ZeroDelayFiresOnNextTick) {
+    TimingWheel wheel(1000);
+    int count = 0;
+    wheel.schedule(0, [&] { ++count; });
+    wheel.scheduleAt(3, [&] { ++count; }); // in the past
+    EXPECT_EQ(wheel.advance(1000), 0);
+    EXPECT_EQ(wheel.advance(1001), 2);
+}
+
+TEST(TimingWheelTest, HugeDelaysCascadeDown) {
+    TimingWheel wheel;
+    std::vector<uint64_t> fired;
+    const std::vector<uint64_t> deadlines = {
+        uint64_t{1} << 40, (uint64_t{1} << 40) + 1, uint64_t{1} << 62, UINT64_MAX - 1};
+    for (uint64_t d : deadlines) {
+        wheel.scheduleAt(d, [&fired, &wheel] { fired.push_back(wheel.now()); });
+    }
+
+    wheel.advance((uint64_t{1} << 40) - 1);
+    EXPECT_TRUE(fired.empty());
+    wheel.advance(UINT64_MAX - 1);
+    EXPECT_EQ(fired, deadlines);
+}
+
+TEST(TimingWheelTest, CallbacksMayReschedule) {
+    TimingWheel wheel;
+    int ticks = 0;
+    std::function<void()> periodic = [&] {
+        ++ticks;
+        if (ticks < 5) wheel.schedule(100, periodic);
+    };
+    wheel.schedule(100, periodic);
+
+    EXPECT_EQ(wheel.advance(10000), 5);
+    EXPECT_EQ(ticks, 5);
+    EXPECT_THROW(
+        {
+            wheel.schedule(1, [&] { wheel.advance(wheel.now() + 10); });
+            wheel.advance(wheel.now() + 1);
+        },
+        std::logic_error);
+}
+
+TEST(TimingWheelTest, ThrowingCallbackDoesNotDropOthers) {
+    TimingWheel wheel;
+    int count = 0;
+    wheel.schedule(1, [] { throw std::runtime_error("boom"); });
+    wheel.schedule(1, [&] { ++count; });
+    wheel.schedule(2, [&] { ++count; });
+    EXPECT_THROW(wheel.advance(5), std::runtime_error);
+    EXPECT_EQ(count, 2);
+    EXPECT_TRUE(wheel.isEmpty());
+}
+
+TEST(TimingWheelTest, MatchesReferenceUnderRandomLoad) {
+    std::mt19937_64 rng(42);
+    TimingWheel wheel;
+    std::vector<uint64_t> deadline;        // by timer number
+    std::vector<uint64_t> firedAt;         // 0 = not fired
+    std::vector<bool> cancelled;
+    std::vector<std::pair<TimingWheel::TimerId, int>> live;
+
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 50; ++i) {
+            // Mix of short, medium and very long delays.
+            uint64_t delay = rng() % 4 == 0 ? rng() % 5000000 : rng() % 300;
+            int n = static_cast<int>(deadline.size());
+            deadline.push_back(wheel.now() + (delay == 0 ? 1 : delay));
+            firedAt.push_back(0);
+            cancelled.push_back(false);
+            auto id = wheel.schedule(delay, [&firedAt, &wheel, n] { firedAt[n] = wheel.now(); });
+            live.emplace_back(id, n);
+        }
+        for (int i = 0; i < 10; ++i) {
+            size_t k = rng() % live.size();
+            if (wheel.cancel(live[k].first)) cancelled[live[k].second] = true;
+            live[k] = live.back();
+            live.pop_back();
+        }
+        wheel.advance(wheel.now() + rng() % 20000);
+
+        size_t pending = 0;
+        for (size_t n = 0; n < deadline.size(); ++n) {
+            if (cancelled[n]) {
+                ASSERT_EQ(firedAt[n], 0u);
+            } else if (deadline[n] <= wheel.now()) {
+                ASSERT_EQ(firedAt[n], deadline[n]) << "timer " << n;
+            } else {
+                ASSERT_EQ(firedAt[n], 0u);
+                ++pending;
+            }
+        }
+        ASSERT_EQ(wheel.size(), pending);
+    }
+
+    wheel.advance(UINT64_MAX);
+    EXPECT_TRUE(wheel.isEmpty());
+    for (size_t n = 0; n < deadline.size(); ++n) {
+        if (!cancelled[n]) {
+            ASSERT_EQ(firedAt[n], deadline[n]);
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "WorkStealingDeque.h"
+
+using namespace dsa;
+
+TEST(WorkStealingDequeTest, OwnerPopsLifo) {
+    WorkStealingDeque<int> dq;
+    dq.pushBottom(1);
+    dq.pushBottom(2);
+    dq.pushBottom(3);
+
+    EXPECT_EQ(dq.size(), 3u);
+    EXPECT_EQ(dq.popBottom(), 3);
+    EXPECT_EQ(dq.popBottom(), 2);
+    EXPECT_EQ(dq.popBottom(), 1);
+    EXPECT_EQ(dq.popBottom(), std::nullopt);
+    EXPECT_TRUE(dq.isEmpty());
+}
+
+TEST(WorkStealingDequeTest, ThiefStealsFifo) {
+    WorkStealingDeque<int> dq;
+    dq.pushBottom(1);
+    dq.pushBottom(2);
+    dq.pushBottom(3);
+
+    EXPECT_EQ(dq.steal(), 1);
+    EXPECT_EQ(dq.steal(), 2);
+    EXPECT_EQ(dq.popBottom(), 3);
+    EXPECT_EQ(dq.steal(), std::nullopt);
+}
+
+TEST(WorkStealingDequeTest, GrowsPastInitialCapacity) {
+    WorkStealingDeque<int> dq(4);
+    for (int i = 0; i < 100; ++i) dq.pushBottom(i);
+
+    EXPECT_GE(dq.capacity(), 100u);
+    EXPECT_EQ(dq.steal(), 0);
+    for (int i = 99; i >= 1; --i) EXPECT_EQ(dq.popBottom(), i);
+    EXPECT_TRUE(dq.isEmpty());
+}
+
+TEST(WorkStealingDequeTest, ConcurrentStealsTakeEachElementOnce) {
+    constexpr int count = 100000;
+    constexpr int thieves = 3;
+    WorkStealingDeque<int> dq(8);
+    std::vector<std::atomic<int>> seen(count);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            while (!done.load() || !dq.isEmpty()) {
+                if (auto v = dq.steal()) seen[*v].fetch_add(1);
+            }
+        });
+    }
+
+    for (int i = 0; i < count; ++i) {
+        dq.pushBottom(i);
+        if (i % 3 == 0) {
+            if (auto v = dq.popBottom()) seen[*v].fetch_add(1);
+        }
+    }
+    while (auto v = dq.popBottom()) seen[*v].fetch_add(1);
+    done.store(true);
+    for (auto& th : threads) th.join();
+
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(seen[i].load(), 1) << "element " << i;
+    }
+}
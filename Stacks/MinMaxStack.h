@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include "Stack.h"
+
+namespace dsa {
+    /**
+     * @brief A LIFO stack that reports its minimum and maximum in O(1).
+     *
+     * Each entry on the underlying dsa::Stack records the minimum and maximum
+     * of everything at or below it, so the extremes after a pop are simply
+     * those stored on the new top; nothing is ever recomputed.
+     *
+     * @tparam T The type of element stored. Must be comparable with operator<.
+     */
+    template<typename T>
+    class MinMaxStack {
+    private:
+        /// @brief A value plus the extremes of the stack up to and including it.
+        struct Entry {
+            T value;
+            T min;
+            T max;
+        };
+
+        Stack<Entry> stack_;
+        size_t       size_ = 0;   // Tracked here; Stack::size() is O(n).
+
+    public:
+        /**
+         * @brief Pushes a new element onto the top of the stack. O(1).
+         * @param value The value to be pushed.
+         */
+        void push(const T& value);
+
+        /**
+         * @brief Removes the top element from the stack. O(1).
+         * @throws std::runtime_error if the stack is empty.
+         */
+        void pop();
+
+        /**
+         * @brief Returns the top element. O(1).
+         * @throws std::runtime_error if the stack is empty.
+         */
+        T top() const;
+
+        /**
+         * @brief Returns the smallest element on the stack. O(1).
+         * @throws std::runtime_error if the stack is empty.
+         */
+        T currentMin() const;
+
+        /**
+         * @brief Returns the largest element on the stack. O(1).
+         * @throws std::runtime_error if the stack is empty.
+         */
+        T currentMax() const;
+
+        /// @brief Returns the number of elements. O(1).
+        size_t size() const;
+
+        /// @brief Checks if the stack is empty. O(1).
+        bool isEmpty() const;
+
+        /// @brief Clears all elements from the stack. O(n).
+        void clear();
+    };
+
+} // namespace dsa
+
+#include "MinMaxStack.tpp"
@@ -0,0 +1,58 @@
+namespace dsa {
+
+    template<typename T>
+    void MinMaxStack<T>::push(const T& value) {
+        if (stack_.isEmpty()) {
+            stack_.push(Entry{value, value, value});
+        } else {
+            Entry below = stack_.top();
+            stack_.push(Entry{value,
+                              value < below.min ? value : below.min,
+                              below.max < value ? value : below.max});
+        }
+        ++size_;
+    }
+
+    template<typename T>
+    void MinMaxStack<T>::pop() {
+        if (stack_.isEmpty())
+            throw std::runtime_error("Stack underflow: cannot pop from empty stack");
+        stack_.pop();
+        --size_;
+    }
+
+    template<typename T>
+    T MinMaxStack<T>::top() const {
+        if (stack_.isEmpty()) throw std::runtime_error("MinMaxStack is empty. No top element.");
+        return stack_.top().value;
+    }
+
+    template<typename T>
+    T MinMaxStack<T>::currentMin() const {
+        if (stack_.isEmpty()) throw std::runtime_error("MinMaxStack is empty. No minimum.");
+        return stack_.top().min;
+    }
+
+    template<typename T>
+    T MinMaxStack<T>::currentMax() const {
+        if (stack_.isEmpty()) throw std::runtime_error("MinMaxStack is empty. No maximum.");
+        return stack_.top().max;
+    }
+
+    template<typename T>
+    size_t MinMaxStack<T>::size() const {
+        return size_;
+    }
+
+    template<typename T>
+    bool MinMaxStack<T>::isEmpty() const {
+        return size_ == 0;
+    }
+
+    template<typename T>
+    void MinMaxStack<T>::clear() {
+        stack_.clear();
+        size_ = 0;
+    }
+
+} // namespace dsa
@@ -9,7 +9,7 @@ namespace dsa {
     void Stack<T>::pop() {
         if (list.isEmpty())
             throw std::runtime_error("Stack underflow: cannot pop from empty stack");
-        list.remove(list.front());
+        list.removeFront();
     }
 
     template<typename T>
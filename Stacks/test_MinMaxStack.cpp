@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "MinMaxStack.h"
+
+using namespace dsa;
+
+TEST(MinMaxStackTest, TracksExtremesThroughPops) {
+    MinMaxStack<int> s;
+    s.push(5);
+    s.push(2);
+    s.push(8);
+    s.push(2);
+    EXPECT_EQ(s.currentMin(), 2);
+    EXPECT_EQ(s.currentMax(), 8);
+    EXPECT_EQ(s.size(), 4);
+
+    s.pop();
+    EXPECT_EQ(s.currentMin(), 2); // the older 2 is still there
+    s.pop();
+    EXPECT_EQ(s.currentMax(), 5);
+    s.pop();
+    EXPECT_EQ(s.top(), 5);
+    EXPECT_EQ(s.currentMin(), 5);
+}
+
+TEST(MinMaxStackTest, NonIntegralValues) {
+    MinMaxStack<std::string> s;
+    s.push("pear");
+    s.push("apple");
+    s.push("zucchini");
+    EXPECT_EQ(s.currentMin(), "apple");
+    EXPECT_EQ(s.currentMax(), "zucchini");
+}
+
+TEST(MinMaxStackTest, EmptyAndClear) {
+    MinMaxStack<int> s;
+    EXPECT_TRUE(s.isEmpty());
+    EXPECT_THROW(s.pop(), std::runtime_error);
+    EXPECT_THROW(s.top(), std::runtime_error);
+    EXPECT_THROW(s.currentMin(), std::runtime_error);
+    EXPECT_THROW(s.currentMax(), std::runtime_error);
+
+    s.push(1);
+    s.clear();
+    EXPECT_TRUE(s.isEmpty());
+    s.push(9);
+    EXPECT_EQ(s.currentMax(), 9);
+}
@@ -149,7 +149,7 @@ TEST(BinarySearchTreeTest, InOrderTraversalReturnsSortedKeys) {
     auto result = tree.inOrderTraversal();
 
     ASSERT_EQ(result.size(), 3);
-    EXPECT_EQ(result[0], std::make_pair(2, "two"));
-    EXPECT_EQ(result[1], std::make_pair(5, "five"));
-    EXPECT_EQ(result[2], std::make_pair(8, "eight"));
+    EXPECT_EQ(result[0], std::make_pair(2, std::string("two")));
+    EXPECT_EQ(result[1], std::make_pair(5, std::string("five")));
+    EXPECT_EQ(result[2], std::make_pair(8, std::string("eight")));
 }
@@ -1,4 +1,5 @@
 #include "Trie.h"
+#include <algorithm>
 
 namespace dsa {
 